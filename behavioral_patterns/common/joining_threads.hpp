@@ -0,0 +1,47 @@
+#ifndef BEHAVIORAL_PATTERNS_COMMON_JOINING_THREADS_HPP
+#define BEHAVIORAL_PATTERNS_COMMON_JOINING_THREADS_HPP
+
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace behavioral {
+namespace common {
+
+/**
+ * The worker threads of a fork-join section, joined when the object goes out of scope. A std::thread that is still
+ * joinable when destroyed calls std::terminate, so a plain std::vector<std::thread> turns any exception thrown
+ * between starting the workers and joining them (a failed thread creation, or the calling thread's own share of the
+ * work throwing) into a crash; here the exception propagates once every started thread has finished.
+ */
+class JoiningThreads {
+ public:
+  JoiningThreads() = default;
+  explicit JoiningThreads(size_t capacity) { threads_.reserve(capacity); }
+
+  JoiningThreads(const JoiningThreads&) = delete;
+  JoiningThreads& operator=(const JoiningThreads&) = delete;
+
+  ~JoiningThreads() { Join(); }
+
+  // Starts std::thread{function, args...}.
+  template <typename Function, typename... Args>
+  void Start(Function&& function, Args&&... args) {
+    threads_.emplace_back(std::forward<Function>(function), std::forward<Args>(args)...);
+  }
+
+  // Waits for every started thread; safe to call more than once.
+  void Join() {
+    for (auto& thread : threads_)
+      if (thread.joinable()) thread.join();
+  }
+
+ private:
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace common
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_COMMON_JOINING_THREADS_HPP
@@ -0,0 +1,191 @@
+#ifndef BEHAVIORAL_PATTERNS_EXERCISES_CARD_GAME_HPP
+#define BEHAVIORAL_PATTERNS_EXERCISES_CARD_GAME_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "behavioral_patterns/common/joining_threads.hpp"
+
+namespace behavioral {
+namespace template_method_exercise {
+
+struct Creature {
+  Creature(int attack, int health) : attack_(attack), health_(health) {}
+
+  int attack_, health_;
+};
+
+struct CardGame {
+  CardGame(const std::vector<Creature> &creatures) : creatures_(creatures) {}
+
+  // return the index of the creature that won (is a live)
+  // example:
+  // - creature1 alive, creature2 dead, return creature1
+  // - creature1 dead, creature2 alive, return creature2
+  // - no clear winner: return -1
+  int combat(int creature1, int creature2) {
+    Creature &first = creatures_[static_cast<long unsigned int>(creature1)];
+    Creature &second = creatures_[static_cast<long unsigned int>(creature2)];
+    hit(first, second);
+    hit(second, first);
+    bool first_alive = first.health_ > 0;
+    bool second_alive = second.health_ > 0;
+    if (first_alive == second_alive) return -1;
+    return first_alive ? creature1 : creature2;
+  }
+
+  virtual void hit(Creature &attacker, Creature &other) = 0;
+
+  std::vector<Creature> creatures_;
+};
+
+/**
+ * Damage policies for Tournament, the compile-time counterparts of the hit() overrides below. Hit() is a template so
+ * the same rule runs on one int or on a GCC/Clang vector of ints, one creature per lane.
+ */
+struct TemporaryDamage {
+  template <typename T>
+  static void Hit(T &health, const T &attack) {
+    T after = health - attack;
+    health = after > 0 ? health : after;  // survivors heal at the end of combat
+  }
+};
+
+struct PermanentDamage {
+  template <typename T>
+  static void Hit(T &health, const T &attack) {
+    health -= attack;
+  }
+};
+
+struct TemporaryCardDamageGame : CardGame {
+  TemporaryCardDamageGame(const std::vector<Creature> &creatures) : CardGame(creatures) {}
+
+  void hit(Creature &attacker, Creature &other) override { TemporaryDamage::Hit(other.health_, attacker.attack_); }
+};
+
+struct PermanentCardDamageGame : CardGame {
+  PermanentCardDamageGame(const std::vector<Creature> &creatures) : CardGame(creatures) {}
+
+  void hit(Creature &attacker, Creature &other) override { PermanentDamage::Hit(other.health_, attacker.attack_); }
+};
+
+/**
+ * Resolves many matchups at once. A matchup is what calling CardGame::combat `rounds` times on a fresh pair of
+ * creatures gives, with the damage rule fixed at compile time instead of a virtual hit() per blow.
+ *
+ * Attack and health are kept in two contiguous arrays, and RoundRobin() fights one creature against 8 opponents per
+ * step, one per lane of a 256-bit vector (one AVX2 instruction per operation when the CPU has it, two SSE ones
+ * otherwise). Rows of the N x N table are split across threads.
+ */
+template <typename Damage>
+class Tournament {
+ public:
+  Tournament(const std::vector<Creature> &creatures, int rounds = 1) : rounds_(rounds) {
+    for (auto &creature : creatures) {
+      attack_.push_back(creature.attack_);
+      health_.push_back(creature.health_);
+    }
+  }
+
+  size_t size() const { return attack_.size(); }
+
+  // wins[i] is the number of creatures that creature i beats.
+  std::vector<uint32_t> RoundRobin(size_t threads) const {
+    std::vector<uint32_t> wins(size());
+    ParallelFor(size(), threads, [this, &wins](size_t i) { wins[i] = WinsInRow(i); });
+    return wins;
+  }
+
+  // The winner of every matchup, or -1, as CardGame::combat reports it.
+  std::vector<int> Resolve(const std::vector<std::pair<int, int>> &matchups, size_t threads) const {
+    for (auto [first, second] : matchups)
+      if (first < 0 || second < 0 || static_cast<size_t>(std::max(first, second)) >= size())
+        throw std::out_of_range("No such creature");
+
+    std::vector<int> winners(matchups.size());
+    ParallelFor(matchups.size(), threads, [this, &matchups, &winners](size_t m) {
+      auto [first, second] = matchups[m];
+      auto i = static_cast<size_t>(first), j = static_cast<size_t>(second);
+      auto health1 = health_[i], health2 = health_[j];
+      Fight(health1, attack_[i], health2, attack_[j]);
+      bool alive1 = health1 > 0, alive2 = health2 > 0;
+      auto winner = alive1 ? first : second;
+      winners[m] = alive1 != alive2 ? winner : -1;  // selects rather than branches; outcomes are unpredictable
+    });
+    return winners;
+  }
+
+ private:
+  using Lanes = int32_t __attribute__((vector_size(32)));
+  static constexpr size_t kLanes = sizeof(Lanes) / sizeof(int32_t);
+
+  template <typename T>
+  __attribute__((always_inline)) void Fight(T &health1, const T &attack1, T &health2, const T &attack2) const {
+    for (int round = 0; round < rounds_; ++round) {
+      Damage::Hit(health2, attack1);
+      Damage::Hit(health1, attack2);
+    }
+  }
+
+  // Wins of creature i against everyone; i against itself is always a draw.
+  __attribute__((always_inline)) uint32_t WinsInRowLanes(size_t i) const {
+    Lanes wins{};
+    Lanes attack1 = Lanes{} + attack_[i];
+    size_t j{0};
+    for (; j + kLanes <= size(); j += kLanes) {
+      Lanes health1 = Lanes{} + health_[i];
+      Lanes health2, attack2;
+      std::memcpy(&health2, &health_[j], sizeof(Lanes));
+      std::memcpy(&attack2, &attack_[j], sizeof(Lanes));
+      Fight(health1, attack1, health2, attack2);
+      wins -= (health1 > 0) & (health2 <= 0);  // a true comparison is -1 in every lane
+    }
+    uint32_t total{0};
+    for (size_t lane = 0; lane < kLanes; ++lane) total += static_cast<uint32_t>(wins[lane]);
+    for (; j < size(); ++j) {
+      auto health1 = health_[i], health2 = health_[j];
+      Fight(health1, attack_[i], health2, attack_[j]);
+      total += health1 > 0 && health2 <= 0;
+    }
+    return total;
+  }
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  __attribute__((target("avx2"))) uint32_t WinsInRowAvx2(size_t i) const { return WinsInRowLanes(i); }
+
+  uint32_t WinsInRow(size_t i) const {
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2 ? WinsInRowAvx2(i) : WinsInRowLanes(i);
+  }
+#else
+  uint32_t WinsInRow(size_t i) const { return WinsInRowLanes(i); }
+#endif
+
+  template <typename Body>
+  static void ParallelFor(size_t count, size_t threads, Body body) {
+    threads = std::max<size_t>(1, std::min(threads, count / 64 + 1));
+    auto per_thread = count / threads + 1;
+    auto run = [&body, count, per_thread](size_t thread) {
+      auto end = std::min(count, (thread + 1) * per_thread);
+      for (auto k = thread * per_thread; k < end; ++k) body(k);
+    };
+    common::JoiningThreads pool{threads - 1};
+    for (size_t thread = 1; thread < threads; ++thread) pool.Start(run, thread);
+    run(0);
+  }
+
+  std::vector<int32_t> attack_;
+  std::vector<int32_t> health_;
+  int rounds_;
+};
+
+}  // namespace template_method_exercise
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_EXERCISES_CARD_GAME_HPP
@@ -0,0 +1,73 @@
+/**
+ * All 4096 x 4096 matchups of random creatures, one combat each, in matchups per second: CardGame::combat with its
+ * virtual hit(), reusing one two-creature game, against Tournament::RoundRobin on 1 to 8 threads and
+ * Tournament::Resolve on the same matchups listed explicitly.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "card_game.hpp"
+
+namespace {
+
+using namespace behavioral::template_method_exercise;
+
+constexpr size_t kCreatures = 4096;
+
+std::vector<Creature> RandomCreatures() {
+  std::mt19937 random{42};
+  std::uniform_int_distribution<int> stat{0, 10};
+  std::vector<Creature> creatures;
+  for (size_t i = 0; i < kCreatures; ++i) creatures.emplace_back(stat(random), 1 + stat(random));
+  return creatures;
+}
+
+void BM_VirtualCombat(benchmark::State& state) {
+  auto creatures = RandomCreatures();
+  TemporaryCardDamageGame game{{creatures[0], creatures[0]}};
+  CardGame* base = &game;
+  benchmark::DoNotOptimize(base);  // hides the dynamic type, so hit() stays a virtual call
+  for (auto _ : state) {
+    uint64_t wins{0};
+    for (auto& first : creatures) {
+      for (auto& second : creatures) {
+        base->creatures_[0] = first;
+        base->creatures_[1] = second;
+        wins += base->combat(0, 1) == 0;
+      }
+    }
+    benchmark::DoNotOptimize(wins);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kCreatures * kCreatures));
+}
+
+void BM_RoundRobin(benchmark::State& state) {
+  Tournament<TemporaryDamage> tournament{RandomCreatures()};
+  for (auto _ : state) {
+    auto wins = tournament.RoundRobin(static_cast<size_t>(state.range(0)));
+    benchmark::DoNotOptimize(wins.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kCreatures * kCreatures));
+}
+
+void BM_Resolve(benchmark::State& state) {
+  Tournament<TemporaryDamage> tournament{RandomCreatures()};
+  std::vector<std::pair<int, int>> matchups;
+  for (size_t i = 0; i < kCreatures; ++i)
+    for (size_t j = 0; j < kCreatures; ++j) matchups.emplace_back(i, j);
+  for (auto _ : state) {
+    auto winners = tournament.Resolve(matchups, static_cast<size_t>(state.range(0)));
+    benchmark::DoNotOptimize(winners.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(matchups.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_VirtualCombat)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RoundRobin)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Resolve)->Arg(1)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
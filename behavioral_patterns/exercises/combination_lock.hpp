@@ -0,0 +1,151 @@
+#ifndef BEHAVIORAL_PATTERNS_EXERCISES_COMBINATION_LOCK_HPP
+#define BEHAVIORAL_PATTERNS_EXERCISES_COMBINATION_LOCK_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace behavioral {
+namespace state_pattern_exercise {
+
+inline uint8_t CheckedDigit(int digit) {
+  if (digit < 0 || digit > 9) throw std::invalid_argument("A digit must be between 0 and 9");
+  return static_cast<uint8_t>(digit);
+}
+
+/**
+ * The lock's state is two counters: how many digits have been entered and how many of them were right. Entering a
+ * digit is a comparison and two increments; the status text is only built when status() is called. Entering a digit
+ * after OPEN or ERROR starts a new attempt.
+ */
+class CombinationLock {
+ public:
+  explicit CombinationLock(const std::vector<int>& combination) : entered_digits_(combination.size()) {
+    if (combination.empty()) throw std::invalid_argument("A combination needs at least one digit");
+    for (auto digit : combination) combination_.push_back(CheckedDigit(digit));
+  }
+
+  void enter_digit(int digit) {
+    if (entered_ == combination_.size()) entered_ = correct_ = 0;
+    auto d = CheckedDigit(digit);
+    entered_digits_[entered_] = static_cast<char>('0' + d);
+    correct_ += combination_[entered_] == d;
+    ++entered_;
+  }
+
+  bool is_open() const { return entered_ == combination_.size() && correct_ == entered_; }
+
+  std::string status() const {
+    if (entered_ == 0) return "LOCKED";
+    if (entered_ == combination_.size()) return correct_ == entered_ ? "OPEN" : "ERROR";
+    return {entered_digits_.data(), entered_};
+  }
+
+ private:
+  std::vector<uint8_t> combination_;
+  std::vector<char> entered_digits_;  // only read by status()
+  size_t entered_{0};
+  size_t correct_{0};
+};
+
+/**
+ * Finds any of many combinations in a stream of digits with one table lookup per digit, however many combinations
+ * there are. The combinations are compiled into a deterministic automaton (Aho-Corasick): a state is the longest
+ * suffix of the input that is a prefix of some combination, and a table holds the next state for each of the ten
+ * digits, so no digit is ever looked at twice.
+ *
+ * When several combinations end at the same digit, the longest of them is reported; shorter ones that are suffixes
+ * of it are only reported when no longer combination ends there. Of identical combinations the first listed wins.
+ * For {{2, 3}, {1, 2, 3}}, the input 1 2 3 reports 1, while 0 2 3 reports 0.
+ */
+class CombinationMatcher {
+ public:
+  static constexpr size_t kNoMatch = SIZE_MAX;  // no combination ends at this digit
+
+  explicit CombinationMatcher(const std::vector<std::vector<int>>& combinations) {
+    AddState();
+    for (size_t i = 0; i < combinations.size(); ++i) {
+      if (combinations[i].empty()) throw std::invalid_argument("A combination needs at least one digit");
+      uint32_t state{0};
+      for (auto digit : combinations[i]) {
+        auto cell = state * kDigits + CheckedDigit(digit);
+        if (next_[cell] == 0) next_[cell] = AddState();
+        state = next_[cell];
+      }
+      if (match_[state] == kNoMatch) match_[state] = i;
+    }
+    Compile();
+  }
+
+  // Advances by one digit (0-9, otherwise std::invalid_argument); returns the index of the longest combination
+  // that ends with it, as described above, or kNoMatch.
+  size_t Feed(int digit) {
+    state_ = next_[state_ * kDigits + CheckedDigit(digit)];
+    return match_[state_];
+  }
+
+  // Number of positions in `digits` where some combination ends, continuing from the current state. A digit above 9
+  // throws std::invalid_argument and leaves the state as it was.
+  size_t Count(const std::vector<uint8_t>& digits) {
+    size_t matches{0};
+    auto state = state_;
+    bool invalid{false};  // checked once at the end rather than branching on every digit
+    for (auto digit : digits) {
+      invalid |= digit >= kDigits;
+      state = next_[state * kDigits + std::min<size_t>(digit, kDigits - 1)];
+      matches += match_[state] != kNoMatch;
+    }
+    if (invalid) throw std::invalid_argument("A digit must be between 0 and 9");
+    state_ = state;
+    return matches;
+  }
+
+  void Reset() { state_ = 0; }
+  size_t States() const { return match_.size(); }
+
+ private:
+  static constexpr size_t kDigits = 10;
+
+  uint32_t AddState() {
+    next_.resize(next_.size() + kDigits, 0);
+    match_.push_back(kNoMatch);
+    return static_cast<uint32_t>(match_.size() - 1);
+  }
+
+  // Turns the trie into the automaton, breadth first so every state's fallback is finished before it is used.
+  void Compile() {
+    std::vector<uint32_t> fallback(match_.size(), 0);
+    std::queue<uint32_t> pending;
+    for (size_t digit = 0; digit < kDigits; ++digit)
+      if (next_[digit] != 0) pending.push(next_[digit]);
+
+    while (!pending.empty()) {
+      auto state = pending.front();
+      pending.pop();
+      if (match_[state] == kNoMatch) match_[state] = match_[fallback[state]];  // a shorter combination ends here
+      for (size_t digit = 0; digit < kDigits; ++digit) {
+        auto& next = next_[state * kDigits + digit];
+        auto otherwise = next_[fallback[state] * kDigits + digit];
+        if (next == 0) {
+          next = otherwise;
+        } else {
+          fallback[next] = otherwise;
+          pending.push(next);
+        }
+      }
+    }
+  }
+
+  std::vector<uint32_t> next_;  // next_[state * 10 + digit]
+  std::vector<size_t> match_;   // longest combination ending on entering each state
+  uint32_t state_{0};
+};
+
+}  // namespace state_pattern_exercise
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_EXERCISES_COMBINATION_LOCK_HPP
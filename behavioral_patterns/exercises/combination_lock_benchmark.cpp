@@ -0,0 +1,132 @@
+/**
+ * 10M random digits through the combination lock and the combination matcher.
+ * The string lock is the previous CombinationLock, which rebuilt its status text on every digit; the naive matcher
+ * checks every combination at every position.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "combination_lock.hpp"
+
+namespace {
+
+using namespace behavioral::state_pattern_exercise;
+
+constexpr size_t kDigits = 10'000'000;
+
+std::vector<uint8_t> RandomDigits(size_t count) {
+  std::mt19937 random{42};
+  std::uniform_int_distribution<int> digit{0, 9};
+  std::vector<uint8_t> digits(count);
+  for (auto& d : digits) d = static_cast<uint8_t>(digit(random));
+  return digits;
+}
+
+std::vector<std::vector<int>> RandomCombinations(size_t count) {
+  std::mt19937 random{7};
+  std::uniform_int_distribution<int> digit{0, 9};
+  std::uniform_int_distribution<size_t> length{4, 6};
+  std::vector<std::vector<int>> combinations(count);
+  for (auto& combination : combinations) {
+    combination.resize(length(random));
+    for (auto& d : combination) d = digit(random);
+  }
+  return combinations;
+}
+
+class StringLock {
+ public:
+  std::string status{"LOCKED"};
+
+  explicit StringLock(const std::vector<int>& combination) : combination_(combination) {}
+
+  void enter_digit(int digit) {
+    if (digits_entered_ == combination_.size()) {
+      status = "LOCKED";
+      digits_entered_ = 0;
+      failed_ = false;
+    }
+    if (status == "LOCKED") status = "";
+    status += std::to_string(digit);
+    if (combination_[digits_entered_] != digit) failed_ = true;
+    digits_entered_++;
+    if (digits_entered_ == combination_.size()) status = failed_ ? "ERROR" : "OPEN";
+  }
+
+ private:
+  std::vector<int> combination_;
+  size_t digits_entered_{0};
+  bool failed_{false};
+};
+
+void BM_StringLock(benchmark::State& state) {
+  auto digits = RandomDigits(kDigits);
+  for (auto _ : state) {
+    StringLock lock{{1, 2, 3, 4, 5}};
+    size_t opened{0};
+    for (auto digit : digits) {
+      lock.enter_digit(digit);
+      opened += lock.status == "OPEN";
+    }
+    benchmark::DoNotOptimize(opened);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kDigits));
+}
+
+void BM_IntegerLock(benchmark::State& state) {
+  auto digits = RandomDigits(kDigits);
+  for (auto _ : state) {
+    CombinationLock lock{{1, 2, 3, 4, 5}};
+    size_t opened{0};
+    for (auto digit : digits) {
+      lock.enter_digit(digit);
+      opened += lock.is_open();
+    }
+    benchmark::DoNotOptimize(opened);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kDigits));
+}
+
+void BM_NaiveMatcher(benchmark::State& state) {
+  auto digits = RandomDigits(kDigits);
+  auto combinations = RandomCombinations(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    size_t matches{0};
+    for (size_t end = 1; end <= digits.size(); ++end) {
+      for (auto& combination : combinations) {
+        if (combination.size() > end) continue;
+        auto start = end - combination.size();
+        size_t i{0};
+        while (i < combination.size() && digits[start + i] == combination[i]) ++i;
+        if (i == combination.size()) {
+          ++matches;
+          break;
+        }
+      }
+    }
+    benchmark::DoNotOptimize(matches);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kDigits));
+}
+
+void BM_DfaMatcher(benchmark::State& state) {
+  auto digits = RandomDigits(kDigits);
+  CombinationMatcher matcher{RandomCombinations(static_cast<size_t>(state.range(0)))};
+  for (auto _ : state) {
+    matcher.Reset();
+    benchmark::DoNotOptimize(matcher.Count(digits));
+  }
+  state.counters["states"] = static_cast<double>(matcher.States());
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kDigits));
+}
+
+}  // namespace
+
+BENCHMARK(BM_StringLock)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_IntegerLock)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_NaiveMatcher)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DfaMatcher)->Arg(10)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
@@ -12,76 +12,160 @@
  *  - calculate("1+2+xy") should return 0
  *  - calculate("10-2-x") when x=3 is in variables should return 5
  */
-#include <iostream>
-#include <regex>
+#include <cctype>
+#include <cstddef>
+#include <limits>
+#include <list>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace behavioral {
 namespace interpreter_pattern_exercise {
 
-inline std::vector<std::string> split(const std::string& stringToSplit) {
-  std::vector<std::string> result;
-  size_t pos = 0, lastPos = 0;
-  while ((pos = stringToSplit.find_first_of("+-", lastPos)) != std::string::npos) {
-    result.push_back(stringToSplit.substr(lastPos, pos - lastPos + 1));
-    lastPos = pos + 1;
+// A pre-parsed expression: a flat list of signed terms, each either a literal or a variable slot.
+// Evaluating it never touches the expression text again.
+struct CompiledExpression {
+  struct Term {
+    bool negate{false};
+    bool is_variable{false};
+    char variable{'\0'};
+    int literal{0};
+  };
+
+  std::vector<Term> terms;
+  bool valid{false};
+
+  int evaluate(const std::unordered_map<char, int>& variables) const {
+    if (!valid) return 0;
+    int current{0};
+    for (const auto& term : terms) {
+      int value = term.literal;
+      if (term.is_variable) {
+        auto it = variables.find(term.variable);
+        if (it == variables.end()) return 0;
+        value = it->second;
+      }
+      // Overflow gets the same 0 as a literal that does not fit in an int.
+      bool overflow = term.negate ? __builtin_sub_overflow(current, value, &current)
+                                  : __builtin_add_overflow(current, value, &current);
+      if (overflow) return 0;
+    }
+    return current;
+  }
+};
+
+// Single pass over the text, no exceptions: any malformed operand yields an invalid program.
+inline CompiledExpression compile(const std::string& expression) {
+  CompiledExpression program;
+  bool negate{false};
+  size_t i{0};
+
+  while (true) {
+    CompiledExpression::Term term;
+    term.negate = negate;
+
+    size_t begin = i;
+    while (i < expression.size() && expression[i] != '+' && expression[i] != '-') ++i;
+    if (i == begin) return program;
+
+    if (i - begin == 1 && std::isalpha(static_cast<unsigned char>(expression[begin]))) {
+      term.is_variable = true;
+      term.variable = expression[begin];
+    } else {
+      long long literal{0};
+      for (size_t j = begin; j < i; ++j) {
+        if (!std::isdigit(static_cast<unsigned char>(expression[j]))) return program;
+        literal = literal * 10 + (expression[j] - '0');
+        if (literal > std::numeric_limits<int>::max()) return program;
+      }
+      term.literal = static_cast<int>(literal);
+    }
+    program.terms.push_back(term);
+
+    if (i == expression.size()) break;
+    negate = expression[i] == '-';
+    ++i;
   }
-  result.push_back(stringToSplit.substr(lastPos));
-  return result;
+
+  program.valid = true;
+  return program;
 }
 
+// Least-recently-used cache: a recency list plus an index into it.
+template <typename Key, typename Value>
+class LruCache {
+ public:
+  // Holds up to `capacity` entries; a cache that can hold nothing is rejected with std::invalid_argument.
+  explicit LruCache(size_t capacity) : capacity_(capacity) {
+    if (capacity_ == 0) throw std::invalid_argument("An LRU cache needs room for at least one entry");
+  }
+
+  // Returns nullptr on a miss. The pointer stays valid until the entry is evicted.
+  const Value* find(const Key& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return &it->second->second;
+  }
+
+  const Value& insert(const Key& key, Value value) {
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      it->second->second = std::move(value);
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->second;
+    }
+    if (entries_.size() >= capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+    entries_.emplace_front(key, std::move(value));
+    index_[key] = entries_.begin();
+    return entries_.front().second;
+  }
+
+  size_t size() const { return entries_.size(); }
+  size_t capacity() const { return capacity_; }
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+  double hit_rate() const {
+    auto lookups = hits_ + misses_;
+    return lookups == 0 ? 0.0 : static_cast<double>(hits_) / static_cast<double>(lookups);
+  }
+
+ private:
+  using Entry = std::pair<Key, Value>;
+
+  size_t capacity_;
+  std::list<Entry> entries_;
+  std::unordered_map<Key, typename std::list<Entry>::iterator> index_;
+  size_t hits_{0};
+  size_t misses_{0};
+};
+
 struct ExpressionProcessor {
   std::unordered_map<char, int> variables;
 
-  enum NextOp { nothing, plus, minus };
+  // Keeps up to `cache_capacity` compiled expressions, at least one.
+  explicit ExpressionProcessor(size_t cache_capacity = 256) : cache_(cache_capacity) {}
 
+  // Variables are looked up at evaluation time, so changing them never invalidates the cache.
   int calculate(const std::string& expression) {
-    int current;
-    auto next_op = nothing;
-    auto parts = split(expression);
-
-    std::cout << "parts (" << parts.size() << "): ";
-    for (auto& part : parts) std::cout << "`" << part << "` ";
-    std::cout << std::endl;
-
-    for (auto& part : parts) {
-      auto no_op = split(part);
-      auto first = no_op[0];
-      int value;
-
-      try {
-        value = std::stoi(first);
-      } catch (const std::invalid_argument&) {
-        if (first.length() == 1 && variables.find(first[0]) != variables.end()) {
-          value = variables[first[0]];
-        } else
-          return 0;
-      }
-
-      switch (next_op) {
-        case nothing:
-          current = value;
-          break;
-        case plus:
-          current += value;
-          break;
-        case minus:
-          current -= value;
-          break;
-        default:
-          break;
-      }
+    if (auto program = cache_.find(expression)) return program->evaluate(variables);
+    return cache_.insert(expression, compile(expression)).evaluate(variables);
+  }
 
-      if (*part.rbegin() == '+')
-        next_op = plus;
-      else if (*part.rbegin() == '-')
-        next_op = minus;
-    }
+  const LruCache<std::string, CompiledExpression>& cache() const { return cache_; }
 
-    return current;
-  }
+ private:
+  LruCache<std::string, CompiledExpression> cache_;
 };
 
 }  // namespace interpreter_pattern_exercise
@@ -104,4 +188,58 @@ TEST(InterpreterPatternExerciseTest, SimpleTest) {
   ASSERT_EQ(0, ep.calculate("1+xy"));
 }
 
+TEST(InterpreterPatternExerciseTest, InvalidExpressionsEvaluateToZero) {
+  ExpressionProcessor ep;
+
+  ASSERT_EQ(0, ep.calculate(""));
+  ASSERT_EQ(0, ep.calculate("1+"));
+  ASSERT_EQ(0, ep.calculate("-1"));
+  ASSERT_EQ(0, ep.calculate("1++2"));
+  ASSERT_EQ(0, ep.calculate("1+2a"));
+  ASSERT_EQ(0, ep.calculate("99999999999+1"));
+  ASSERT_EQ(0, ep.calculate("10-2-x"));
+  ASSERT_EQ(0, ep.calculate("2147483647+1"));    // every literal fits, the sum does not
+  ASSERT_EQ(0, ep.calculate("2147483647+1-1"));  // nor does an intermediate result
+  ASSERT_EQ(0, ep.calculate("0-2147483647-2"));
+  ASSERT_EQ(-2147483647 - 1, ep.calculate("0-2147483647-1"));
+}
+
+TEST(InterpreterPatternExerciseTest, CachedProgramsSeeVariableUpdates) {
+  ExpressionProcessor ep;
+  ep.variables['x'] = 3;
+
+  ASSERT_EQ(5, ep.calculate("10-2-x"));
+  ep.variables['x'] = 4;
+  ASSERT_EQ(4, ep.calculate("10-2-x"));
+  ep.variables.erase('x');
+  ASSERT_EQ(0, ep.calculate("10-2-x"));
+
+  ASSERT_EQ(1u, ep.cache().misses());
+  ASSERT_EQ(2u, ep.cache().hits());
+}
+
+TEST(InterpreterPatternExerciseTest, CacheEvictsLeastRecentlyUsed) {
+  ExpressionProcessor ep{2};
+
+  ep.calculate("1+1");
+  ep.calculate("2+2");
+  ep.calculate("1+1");  // "2+2" is now the least recently used
+  ep.calculate("3+3");  // evicts "2+2"
+  ASSERT_EQ(2u, ep.cache().size());
+
+  ASSERT_EQ(2, ep.calculate("1+1"));
+  ASSERT_EQ(4, ep.calculate("2+2"));
+  ASSERT_EQ(2u, ep.cache().hits());
+  ASSERT_EQ(4u, ep.cache().misses());
+  ASSERT_DOUBLE_EQ(1.0 / 3.0, ep.cache().hit_rate());
+}
+
+TEST(InterpreterPatternExerciseTest, CacheNeedsRoomForOneEntry) {
+  ASSERT_THROW(ExpressionProcessor{0}, std::invalid_argument);
+  ExpressionProcessor ep{1};
+  ASSERT_EQ(2, ep.calculate("1+1"));
+  ASSERT_EQ(4, ep.calculate("2+2"));
+  ASSERT_EQ(1u, ep.cache().size());
+}
+
 }  // namespace
@@ -7,7 +7,9 @@
  * as a smart pointer and its value is subsequently changed on that pointer - you still need to return the correct
  * system snapshot!
  */
+#include <cstddef>
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace behavioral {
@@ -19,29 +21,102 @@ struct Token {
   int value_;
 };
 
+/**
+ * Immutable vector: push_back returns a new version and leaves this one untouched.
+ * Elements live in the leaves of a trie with 32 children per node, and a new version copies only the path from the
+ * root to the last leaf (O(log n), at most 32 entries per level), sharing every other node with the old version.
+ * Copying a whole version is O(1), as it only copies the root pointer.
+ */
+template <typename T>
+class PersistentVector {
+ public:
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  const T& operator[](size_t index) const {
+    const Node* node = root_.get();
+    for (size_t shift = shift_; shift > 0; shift -= kBits) node = node->children[(index >> shift) & kMask].get();
+    return node->values[index & kMask];
+  }
+
+  PersistentVector push_back(T value) const {
+    PersistentVector result;
+    result.size_ = size_ + 1;
+    result.shift_ = shift_;
+    if (!root_) {
+      result.root_ = NewPath(0, std::move(value));
+    } else if (size_ == size_t{1} << (shift_ + kBits)) {  // root is full, grow one level
+      auto root = std::make_shared<Node>();
+      root->children = {root_, NewPath(shift_, std::move(value))};
+      result.root_ = std::move(root);
+      result.shift_ = shift_ + kBits;
+    } else {
+      result.root_ = PushPath(*root_, shift_, size_, std::move(value));
+    }
+    return result;
+  }
+
+ private:
+  static constexpr size_t kBits = 5;
+  static constexpr size_t kMask = (size_t{1} << kBits) - 1;
+
+  struct Node {
+    std::vector<std::shared_ptr<const Node>> children;  // interior nodes
+    std::vector<T> values;                              // leaves
+  };
+
+  static std::shared_ptr<const Node> NewPath(size_t shift, T value) {
+    auto node = std::make_shared<Node>();
+    if (shift == 0)
+      node->values.push_back(std::move(value));
+    else
+      node->children.push_back(NewPath(shift - kBits, std::move(value)));
+    return node;
+  }
+
+  static std::shared_ptr<const Node> PushPath(const Node& node, size_t shift, size_t index, T value) {
+    auto copy = std::make_shared<Node>(node);
+    if (shift == 0) {
+      copy->values.push_back(std::move(value));
+      return copy;
+    }
+    auto child = (index >> shift) & kMask;
+    if (child < copy->children.size())
+      copy->children[child] = PushPath(*copy->children[child], shift - kBits, index, std::move(value));
+    else
+      copy->children.push_back(NewPath(shift - kBits, std::move(value)));
+    return copy;
+  }
+
+  std::shared_ptr<const Node> root_;
+  size_t shift_{0};  // kBits times the number of interior levels
+  size_t size_{0};
+};
+
 struct Memento {
-  std::vector<std::shared_ptr<Token>> tokens;
+  PersistentVector<std::shared_ptr<const Token>> tokens;
 };
 
+/**
+ * The machine stores its own immutable copy of every token, taken when the token is fed in, so changing the
+ * caller's token afterwards affects neither the machine nor any memento. Because nothing stored is ever mutated,
+ * mementos share all tokens and trie nodes with the machine: capturing one is a copy of the root pointer,
+ * and so is reverting to one.
+ */
 struct TokenMachine {
-  std::vector<std::shared_ptr<Token>> tokens;
+  PersistentVector<std::shared_ptr<const Token>> tokens;
 
   Memento add_token(int value) { return add_token(std::make_shared<Token>(value)); }
 
   // adds the token to the set of tokens and returns the
   // snapshot of the entire system
   Memento add_token(const std::shared_ptr<Token>& token) {
-    tokens.push_back(token);
-    Memento m;
-    for (auto t : tokens) m.tokens.emplace_back(std::make_shared<Token>(t->value_));
-    return m;
+    tokens = tokens.push_back(std::make_shared<const Token>(token->value_));
+    return Memento{tokens};
   }
 
   // reverts the system to a state represented by the token
-  void revert(const Memento& m) {
-    tokens.clear();
-    for (auto t : m.tokens) tokens.emplace_back(std::make_shared<Token>(t->value_));
-  }
+  void revert(const Memento& m) { tokens = m.tokens; }
 };
 
 }  // namespace memento_pattern_exercise
@@ -93,4 +168,23 @@ TEST(MementoPatternExerciseTest, FiddledTokenTest) {
                                        << "Hint: did you init the memento by-value?";
 }
 
+TEST(MementoPatternExerciseTest, MementosShareStructure) {
+  TokenMachine tm;
+  std::vector<Memento> mementos;
+  const int count{40000};  // three levels of the trie
+  for (int i = 0; i < count; ++i) mementos.push_back(tm.add_token(i));
+
+  tm.revert(mementos[1000]);
+  tm.add_token(-1);  // branches off an old version without touching the newer ones
+  ASSERT_EQ(1002, tm.tokens.size());
+  ASSERT_EQ(-1, tm.tokens[1001]->value_);
+
+  for (int i : {0, 31, 32, 1023, 1024, 1025, count - 1}) {
+    auto& tokens = mementos[static_cast<size_t>(i)].tokens;
+    ASSERT_EQ(static_cast<size_t>(i) + 1, tokens.size());
+    for (int j : {0, i / 2, i}) ASSERT_EQ(j, tokens[static_cast<size_t>(j)]->value_);
+  }
+  ASSERT_EQ(mementos[5].tokens[3], mementos[count - 1].tokens[3]);  // the same token, not a copy
+}
+
 }  // namespace
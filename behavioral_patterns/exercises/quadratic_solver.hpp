@@ -0,0 +1,196 @@
+#ifndef BEHAVIORAL_PATTERNS_EXERCISES_QUADRATIC_SOLVER_HPP
+#define BEHAVIORAL_PATTERNS_EXERCISES_QUADRATIC_SOLVER_HPP
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define BEHAVIORAL_STRATEGY_PATTERN_EXERCISE_AVX2 1
+#endif
+
+namespace behavioral {
+namespace strategy_pattern_exercise {
+
+/**
+ * Kernels behind QuadraticEquationSolver::SolveBatch. They work on structure-of-arrays input, 4 equations per AVX2
+ * instruction when the CPU has it, and give bit-for-bit the results of the one-equation-at-a-time path (no FMA),
+ * signed zeros included.
+ */
+namespace batch {
+
+template <bool kReal>
+void ScalarDiscriminants(const double* a, const double* b, const double* c, double* out, size_t begin, size_t end) {
+  for (auto i = begin; i < end; ++i) {
+    auto discriminant = b[i] * b[i] - 4 * a[i] * c[i];
+    out[i] = kReal && discriminant < 0 ? std::numeric_limits<double>::quiet_NaN() : discriminant;
+  }
+}
+
+// What (-b +- sqrt(std::complex<double>{d, 0})) / (2a) yields, without going through std::complex. The square root
+// is (sqrt(d), +0) for d >= 0 and (+0, sqrt(-d)) for d < 0, and its zero part goes through the same additions and
+// divisions as in Solve(), so e.g. b == 0 gives (+0 - 0) / 2a for the real part of x2 just like Solve() does.
+inline void ScalarRoots(const double* a, const double* b, const double* d, double* re1, double* im1, double* re2,
+                        double* im2, size_t begin, size_t end) {
+  for (auto i = begin; i < end; ++i) {
+    auto root = std::sqrt(std::fabs(d[i]));
+    auto root_re = d[i] < 0 ? 0.0 : root;
+    auto root_im = d[i] < 0 ? root : std::isnan(d[i]) ? d[i] : 0.0;
+    auto two_a = 2 * a[i];
+    re1[i] = (-b[i] + root_re) / two_a;
+    re2[i] = (-b[i] - root_re) / two_a;
+    im1[i] = root_im / two_a;
+    im2[i] = -im1[i];  // same bits as -root_im / two_a
+  }
+}
+
+#ifdef BEHAVIORAL_STRATEGY_PATTERN_EXERCISE_AVX2
+inline bool HasAvx2() {
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+}
+
+// Both return the first equation left for the scalar loop.
+template <bool kReal>
+__attribute__((target("avx2"))) size_t Avx2Discriminants(const double* a, const double* b, const double* c,
+                                                         double* out, size_t n) {
+  const auto four = _mm256_set1_pd(4);
+  const auto nan = _mm256_set1_pd(std::numeric_limits<double>::quiet_NaN());
+  size_t i{0};
+  for (; i + 4 <= n; i += 4) {
+    auto vb = _mm256_loadu_pd(b + i);
+    auto ac4 = _mm256_mul_pd(_mm256_mul_pd(four, _mm256_loadu_pd(a + i)), _mm256_loadu_pd(c + i));
+    auto discriminant = _mm256_sub_pd(_mm256_mul_pd(vb, vb), ac4);
+    if (kReal)
+      discriminant = _mm256_blendv_pd(discriminant, nan,
+                                      _mm256_cmp_pd(discriminant, _mm256_setzero_pd(), _CMP_LT_OQ));
+    _mm256_storeu_pd(out + i, discriminant);
+  }
+  return i;
+}
+
+__attribute__((target("avx2"))) inline size_t Avx2Roots(const double* a, const double* b, const double* d,
+                                                        double* re1, double* im1, double* re2, double* im2,
+                                                        size_t n) {
+  const auto two = _mm256_set1_pd(2);
+  const auto zero = _mm256_setzero_pd();
+  const auto sign = _mm256_set1_pd(-0.0);
+  size_t i{0};
+  for (; i + 4 <= n; i += 4) {
+    auto vd = _mm256_loadu_pd(d + i);
+    auto minus_b = _mm256_xor_pd(_mm256_loadu_pd(b + i), sign);
+    auto two_a = _mm256_mul_pd(two, _mm256_loadu_pd(a + i));
+    auto root = _mm256_sqrt_pd(_mm256_andnot_pd(sign, vd));
+    auto negative = _mm256_cmp_pd(vd, zero, _CMP_LT_OQ);
+
+    // The same (root_re, root_im) split as ScalarRoots.
+    auto root_re = _mm256_blendv_pd(root, zero, negative);
+    auto real_im = _mm256_blendv_pd(zero, vd, _mm256_cmp_pd(vd, vd, _CMP_UNORD_Q));  // NaN stays NaN
+    auto root_im = _mm256_blendv_pd(real_im, root, negative);
+    auto im = _mm256_div_pd(root_im, two_a);
+
+    _mm256_storeu_pd(re1 + i, _mm256_div_pd(_mm256_add_pd(minus_b, root_re), two_a));
+    _mm256_storeu_pd(re2 + i, _mm256_div_pd(_mm256_sub_pd(minus_b, root_re), two_a));
+    _mm256_storeu_pd(im1 + i, im);
+    _mm256_storeu_pd(im2 + i, _mm256_xor_pd(im, sign));
+  }
+  return i;
+}
+#endif
+
+template <bool kReal>
+void Discriminants(const double* a, const double* b, const double* c, double* out, size_t n) {
+  size_t done{0};
+#ifdef BEHAVIORAL_STRATEGY_PATTERN_EXERCISE_AVX2
+  if (HasAvx2()) done = Avx2Discriminants<kReal>(a, b, c, out, n);
+#endif
+  ScalarDiscriminants<kReal>(a, b, c, out, done, n);
+}
+
+inline void Roots(const double* a, const double* b, const double* d, double* re1, double* im1, double* re2,
+                  double* im2, size_t n) {
+  size_t done{0};
+#ifdef BEHAVIORAL_STRATEGY_PATTERN_EXERCISE_AVX2
+  if (HasAvx2()) done = Avx2Roots(a, b, d, re1, im1, re2, im2, n);
+#endif
+  ScalarRoots(a, b, d, re1, im1, re2, im2, done, n);
+}
+
+}  // namespace batch
+
+struct DiscriminantStrategy {
+  virtual double CalculateDiscriminant(double a, double b, double c) = 0;
+
+  // The discriminant of every equation in a batch; one virtual call for the whole batch.
+  virtual void CalculateDiscriminants(const double* a, const double* b, const double* c, double* out,
+                                      size_t n) = 0;
+};
+
+struct OrdinaryDiscriminantStrategy : DiscriminantStrategy {
+  double CalculateDiscriminant(double a, double b, double c) override { return std::pow(b, 2) - 4 * a * c; }
+
+  void CalculateDiscriminants(const double* a, const double* b, const double* c, double* out, size_t n) override {
+    batch::Discriminants<false>(a, b, c, out, n);
+  }
+};
+
+struct RealDiscriminantStrategy : DiscriminantStrategy {
+  double CalculateDiscriminant(double a, double b, double c) override {
+    auto discriminant = std::pow(b, 2) - 4 * a * c;
+    return discriminant >= 0 ? discriminant : std::nan("1");
+  }
+
+  void CalculateDiscriminants(const double* a, const double* b, const double* c, double* out, size_t n) override {
+    batch::Discriminants<true>(a, b, c, out, n);
+  }
+};
+
+// Roots of a batch of equations, one array per component: x1 = re1[i] + im1[i] * i, x2 = re2[i] + im2[i] * i.
+struct QuadraticRoots {
+  std::vector<double> re1, im1, re2, im2;
+};
+
+class QuadraticEquationSolver {
+ public:
+  QuadraticEquationSolver(DiscriminantStrategy& strategy) : strategy_(strategy) {}
+
+  std::tuple<std::complex<double>, std::complex<double>> Solve(double a, double b, double c) {
+    std::complex<double> discriminant{strategy_.CalculateDiscriminant(a, b, c), 0};
+    auto root_disc = sqrt(discriminant);
+    return {(-b + root_disc) / (2 * a), (-b - root_disc) / (2 * a)};
+  }
+
+  // Solves a[i]*x^2 + b[i]*x + c[i] = 0 for every i, with the same results as Solve().
+  QuadraticRoots SolveBatch(const std::vector<double>& a, const std::vector<double>& b, const std::vector<double>& c) {
+    QuadraticRoots roots;
+    SolveBatch(a, b, c, roots);
+    return roots;
+  }
+
+  // Same, reusing the arrays of `roots` from an earlier batch.
+  void SolveBatch(const std::vector<double>& a, const std::vector<double>& b, const std::vector<double>& c,
+                  QuadraticRoots& roots) {
+    auto n = a.size();
+    if (b.size() != n || c.size() != n) throw std::invalid_argument("Coefficient arrays differ in length");
+    discriminants_.resize(n);
+    strategy_.CalculateDiscriminants(a.data(), b.data(), c.data(), discriminants_.data(), n);
+
+    for (auto component : {&roots.re1, &roots.im1, &roots.re2, &roots.im2}) component->resize(n);
+    batch::Roots(a.data(), b.data(), discriminants_.data(), roots.re1.data(), roots.im1.data(), roots.re2.data(),
+                 roots.im2.data(), n);
+  }
+
+ private:
+  DiscriminantStrategy& strategy_;
+  std::vector<double> discriminants_;  // scratch space reused across batches
+};
+
+}  // namespace strategy_pattern_exercise
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_EXERCISES_QUADRATIC_SOLVER_HPP
@@ -0,0 +1,61 @@
+/**
+ * Solving 1M quadratics with each discriminant strategy: one Solve() call per equation, with a virtual call and
+ * std::complex arithmetic each, against one SolveBatch() call over coefficient arrays. Both write into arrays
+ * allocated once.
+ */
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "quadratic_solver.hpp"
+
+namespace {
+
+using namespace behavioral::strategy_pattern_exercise;
+
+constexpr size_t kEquations = 1 << 20;
+
+std::vector<double> Coefficients(unsigned seed) {
+  std::mt19937 random{seed};
+  std::uniform_real_distribution<double> coefficient{-10, 10};
+  std::vector<double> values(kEquations);
+  for (auto& v : values) v = coefficient(random);
+  return values;
+}
+
+template <typename Strategy>
+void BM_Scalar(benchmark::State& state) {
+  auto a = Coefficients(1), b = Coefficients(2), c = Coefficients(3);
+  Strategy strategy;
+  QuadraticEquationSolver solver{strategy};
+  std::vector<std::complex<double>> x1(kEquations), x2(kEquations);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kEquations; ++i) std::tie(x1[i], x2[i]) = solver.Solve(a[i], b[i], c[i]);
+    benchmark::DoNotOptimize(x1.data());
+    benchmark::DoNotOptimize(x2.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kEquations));
+}
+
+template <typename Strategy>
+void BM_Batch(benchmark::State& state) {
+  auto a = Coefficients(1), b = Coefficients(2), c = Coefficients(3);
+  Strategy strategy;
+  QuadraticEquationSolver solver{strategy};
+  QuadraticRoots roots;
+  for (auto _ : state) {
+    solver.SolveBatch(a, b, c, roots);
+    benchmark::DoNotOptimize(roots.re1.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kEquations));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Scalar, OrdinaryDiscriminantStrategy)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Batch, OrdinaryDiscriminantStrategy)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Scalar, RealDiscriminantStrategy)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Batch, RealDiscriminantStrategy)->Unit(benchmark::kMillisecond);
@@ -13,54 +13,21 @@
  * Here is an expmae unit test for the lock:
  *
  * CombinationLock cl({1,2,3});
- * ASSERT_EQ("LOCKED", cl.status);
+ * ASSERT_EQ("LOCKED", cl.status());
  * cl.enter_digit(1);
- * ASSERT_EQ("1", cl.status);
+ * ASSERT_EQ("1", cl.status());
  * cl.enter_digit(2);
- * ASSERT_EQ("12", cl.status);
+ * ASSERT_EQ("12", cl.status());
  * cl.enter_digit(3);
- * ASSERT_EQ("OPEN", cl.status);
+ * ASSERT_EQ("OPEN", cl.status());
  */
-#include <iostream>
-#include <string>
-#include <vector>
-
-namespace behavioral {
-namespace state_pattern_exercise {
-
-class CombinationLock {
- public:
-  std::string status;
-
-  CombinationLock(const std::vector<int> &combination) : combination_(combination) { reset(); }
-
-  void enter_digit(int digit) {
-    if (status == "LOCKED") status = "";
-    status += std::to_string(digit);
-    if (combination_[static_cast<long unsigned int>(digits_entered)] != digit) {
-      failed = true;
-    }
-    digits_entered++;
-
-    if (digits_entered == static_cast<int>(combination_.size())) status = failed ? "ERROR" : "OPEN";
-  }
-
- private:
-  void reset() {
-    status = "LOCKED";
-    digits_entered = 0;
-    failed = false;
-  }
-
-  std::vector<int> combination_;
-  int digits_entered{0};
-  bool failed{false};
-};
-
-}  // namespace state_pattern_exercise
-}  // namespace behavioral
+#include "combination_lock.hpp"
 
 // TEST---------------------------------------------------------------------------------------------------------------|
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace {
@@ -69,30 +36,72 @@ using namespace behavioral::state_pattern_exercise;
 
 TEST(StatePatternExerciseTest, TestSuccess) {
   CombinationLock cl({1, 2, 3});
-  ASSERT_EQ("LOCKED", cl.status);
+  ASSERT_EQ("LOCKED", cl.status());
 
   cl.enter_digit(1);
-  ASSERT_EQ("1", cl.status);
+  ASSERT_EQ("1", cl.status());
 
   cl.enter_digit(2);
-  ASSERT_EQ("12", cl.status);
+  ASSERT_EQ("12", cl.status());
 
   cl.enter_digit(3);
-  ASSERT_EQ("OPEN", cl.status);
+  ASSERT_EQ("OPEN", cl.status());
 }
 
 TEST(StatePatternExerciseTest, TestFailure) {
   CombinationLock cl({1, 2, 3});
-  ASSERT_EQ("LOCKED", cl.status);
+  ASSERT_EQ("LOCKED", cl.status());
 
   cl.enter_digit(1);
-  ASSERT_EQ("1", cl.status);
+  ASSERT_EQ("1", cl.status());
 
   cl.enter_digit(2);
-  ASSERT_EQ("12", cl.status);
+  ASSERT_EQ("12", cl.status());
 
   cl.enter_digit(5);
-  ASSERT_EQ("ERROR", cl.status);
+  ASSERT_EQ("ERROR", cl.status());
+}
+
+TEST(StatePatternExerciseTest, TestRetryAfterError) {
+  CombinationLock cl({1, 2, 3});
+  for (auto digit : {9, 9, 9, 1, 2}) cl.enter_digit(digit);
+  ASSERT_EQ("12", cl.status());
+  ASSERT_FALSE(cl.is_open());
+
+  cl.enter_digit(3);
+  ASSERT_EQ("OPEN", cl.status());
+  ASSERT_TRUE(cl.is_open());
+}
+
+TEST(StatePatternExerciseTest, TestMatcherFindsEveryCombination) {
+  CombinationMatcher matcher({{1, 2, 3}, {2, 3}, {1, 2, 1, 2, 4}, {7}});
+  std::vector<size_t> found;
+  for (auto digit : {1, 2, 1, 2, 1, 2, 4, 1, 2, 3, 5, 7}) found.push_back(matcher.Feed(digit));
+
+  auto none = CombinationMatcher::kNoMatch;
+  // {1, 2, 3} and {2, 3} both end at the same digit; the longer one is reported.
+  std::vector<size_t> expected{none, none, none, none, none, none, 2, none, none, 0, none, 3};
+  ASSERT_EQ(expected, found);
+
+  matcher.Reset();
+  ASSERT_EQ(3u, matcher.Count(std::vector<uint8_t>{1, 2, 1, 2, 1, 2, 4, 1, 2, 3, 5, 7}));
+
+  // Listing the shorter combination first does not change that; it is reported only where it ends alone.
+  CombinationMatcher suffix_first({{2, 3}, {1, 2, 3}});
+  ASSERT_EQ(none, suffix_first.Feed(1));
+  ASSERT_EQ(none, suffix_first.Feed(2));
+  ASSERT_EQ(1u, suffix_first.Feed(3));
+  ASSERT_EQ(none, suffix_first.Feed(2));
+  ASSERT_EQ(0u, suffix_first.Feed(3));
+}
+
+TEST(StatePatternExerciseTest, TestMatcherRejectsInvalidDigits) {
+  CombinationMatcher matcher({{1, 2}});
+  ASSERT_THROW(matcher.Feed(10), std::invalid_argument);
+  ASSERT_THROW(matcher.Feed(-1), std::invalid_argument);
+  ASSERT_EQ(CombinationMatcher::kNoMatch, matcher.Feed(1));
+  ASSERT_THROW(matcher.Count(std::vector<uint8_t>{2, 10}), std::invalid_argument);
+  ASSERT_EQ(0u, matcher.Feed(2));  // the rejected Count() did not move past the 1
 }
 
 }  // namespace
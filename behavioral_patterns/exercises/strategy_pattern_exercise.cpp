@@ -13,48 +13,17 @@
  * Please implement both of these strategies as well as the equation solver itself. With regards to plus-minus in the
  * formula, please return the + result as the first element and - as the second.
  */
+#include "quadratic_solver.hpp"
+
+// TEST---------------------------------------------------------------------------------------------------------------|
 #include <cmath>
 #include <complex>
-#include <iostream>
+#include <cstddef>
+#include <cstring>
+#include <random>
 #include <tuple>
 #include <vector>
 
-namespace behavioral {
-namespace strategy_pattern_exercise {
-
-struct DiscriminantStrategy {
-  virtual double CalculateDiscriminant(double a, double b, double c) = 0;
-};
-
-struct OrdinaryDiscriminantStrategy : DiscriminantStrategy {
-  double CalculateDiscriminant(double a, double b, double c) override { return std::pow(b, 2) - 4 * a * c; }
-};
-
-struct RealDiscriminantStrategy : DiscriminantStrategy {
-  double CalculateDiscriminant(double a, double b, double c) override {
-    auto discriminant = std::pow(b, 2) - 4 * a * c;
-    return discriminant >= 0 ? discriminant : std::nan("1");
-  }
-};
-
-class QuadraticEquationSolver {
- public:
-  QuadraticEquationSolver(DiscriminantStrategy& strategy) : strategy_(strategy) {}
-
-  std::tuple<std::complex<double>, std::complex<double>> Solve(double a, double b, double c) {
-    std::complex<double> discriminant{strategy_.CalculateDiscriminant(a, b, c), 0};
-    auto root_disc = sqrt(discriminant);
-    return {(-b + root_disc) / (2 * a), (-b - root_disc) / (2 * a)};
-  }
-
- private:
-  DiscriminantStrategy& strategy_;
-};
-
-}  // namespace strategy_pattern_exercise
-}  // namespace behavioral
-
-// TEST---------------------------------------------------------------------------------------------------------------|
 #include "gtest/gtest.h"
 
 namespace {
@@ -97,4 +66,38 @@ TEST(StrategyPatternExerciseTest, NegativeTestRealStrategy) {
   EXPECT_TRUE(std::isnan(x2.imag()));
 }
 
+TEST(StrategyPatternExerciseTest, BatchMatchesOneAtATime) {
+  std::mt19937 random{42};
+  std::uniform_real_distribution<double> coefficient{-10, 10};
+  // b == 0 and d == 0 are where the signs of the roots' zero parts show up
+  std::vector<double> a{1, 1, -1, 1, 2, -1, 1}, b{-3, 0, 0, 0, 0, 0, 2}, c{2, 4, 4, 0, -8, 0, 1};
+  while (a.size() < 1003) {  // not a multiple of the vector width
+    a.push_back(coefficient(random));
+    b.push_back(a.size() % 5 ? coefficient(random) : 0.0);
+    c.push_back(coefficient(random));
+  }
+  auto same_bits = [](std::complex<double> x, double re, double im) {  // tells +0 from -0, unlike ==
+    double expected[]{x.real(), x.imag()}, actual[]{re, im};
+    return std::memcmp(expected, actual, sizeof(expected)) == 0;
+  };
+
+  OrdinaryDiscriminantStrategy ordinary;
+  RealDiscriminantStrategy real;
+  for (DiscriminantStrategy* strategy : {static_cast<DiscriminantStrategy*>(&ordinary),
+                                         static_cast<DiscriminantStrategy*>(&real)}) {
+    QuadraticEquationSolver solver{*strategy};
+    auto roots = solver.SolveBatch(a, b, c);
+    for (size_t i = 0; i < a.size(); ++i) {
+      auto [x1, x2] = solver.Solve(a[i], b[i], c[i]);
+      if (std::isnan(x1.real())) {
+        ASSERT_TRUE(std::isnan(roots.re1[i]) && std::isnan(roots.im1[i]));
+        ASSERT_TRUE(std::isnan(roots.re2[i]) && std::isnan(roots.im2[i]));
+        continue;
+      }
+      ASSERT_TRUE(same_bits(x1, roots.re1[i], roots.im1[i])) << i;
+      ASSERT_TRUE(same_bits(x2, roots.re2[i], roots.im2[i])) << i;
+    }
+  }
+}
+
 }  // namespace
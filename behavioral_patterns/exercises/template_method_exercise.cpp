@@ -16,61 +16,14 @@
  *    will win after 2 rounds of combat.
  *  - With either temporary or permanent damage, two 2/2 creatures kill one another.
  */
-#include <vector>
-
-namespace behavioral {
-namespace template_method_exercise {
-
-struct Creature {
-  Creature(int attack, int health) : attack_(attack), health_(health) {}
-
-  int attack_, health_;
-};
-
-struct CardGame {
-  CardGame(const std::vector<Creature> &creatures) : creatures_(creatures) {}
-
-  // return the index of the creature that won (is a live)
-  // example:
-  // - creature1 alive, creature2 dead, return creature1
-  // - creature1 dead, creature2 alive, return creature2
-  // - no clear winner: return -1
-  int combat(int creature1, int creature2) {
-    Creature &first = creatures_[static_cast<long unsigned int>(creature1)];
-    Creature &second = creatures_[static_cast<long unsigned int>(creature2)];
-    hit(first, second);
-    hit(second, first);
-    bool first_alive = first.health_ > 0;
-    bool second_alive = second.health_ > 0;
-    if (first_alive == second_alive) return -1;
-    return first_alive ? creature1 : creature2;
-  }
-
-  virtual void hit(Creature &attacker, Creature &other) = 0;
-
-  std::vector<Creature> creatures_;
-};
-
-struct TemporaryCardDamageGame : CardGame {
-  TemporaryCardDamageGame(const std::vector<Creature> &creatures) : CardGame(creatures) {}
-
-  void hit(Creature &attacker, Creature &other) override {
-    auto old_health = other.health_;
-    other.health_ -= attacker.attack_;
-    if (other.health_ > 0) other.health_ = old_health;
-  }
-};
-
-struct PermanentCardDamageGame : CardGame {
-  PermanentCardDamageGame(const std::vector<Creature> &creatures) : CardGame(creatures) {}
-
-  void hit(Creature &attacker, Creature &other) override { other.health_ -= attacker.attack_; }
-};
-
-}  // namespace template_method_exercise
-}  // namespace behavioral
+#include "card_game.hpp"
 
 // TEST---------------------------------------------------------------------------------------------------------------|
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace {
@@ -107,4 +60,39 @@ TEST(TemplateMethodExerciseTest, PermanentDamageDeathTest) {
   ASSERT_EQ(1, game.combat(0, 1)) << "1/1 vs 1/2 here, so winner should be = 1";
 }
 
+template <typename Damage, typename Game>
+void ExpectTournamentMatchesCombat(int rounds) {
+  std::mt19937 random{42};
+  std::uniform_int_distribution<int> stat{0, 6};
+  std::vector<Creature> creatures;
+  for (int i = 0; i < 37; ++i) creatures.emplace_back(stat(random), 1 + stat(random));
+
+  Tournament<Damage> tournament{creatures, rounds};
+  auto wins = tournament.RoundRobin(3);
+  std::vector<std::pair<int, int>> matchups;
+  for (int i = 0; i < 37; ++i)
+    for (int j = 0; j < 37; ++j) matchups.emplace_back(i, j);
+  auto winners = tournament.Resolve(matchups, 3);
+
+  for (int i = 0; i < 37; ++i) {
+    unsigned expected_wins{0};
+    for (int j = 0; j < 37; ++j) {
+      Game game{{creatures[static_cast<size_t>(i)], creatures[static_cast<size_t>(j)]}};
+      int winner{-1};
+      for (int round = 0; round < rounds; ++round) winner = game.combat(0, 1);
+      auto expected = winner == -1 ? -1 : winner == 0 ? i : j;
+      ASSERT_EQ(expected, winners[static_cast<size_t>(i * 37 + j)]) << i << " vs " << j;
+      expected_wins += winner == 0;
+    }
+    ASSERT_EQ(expected_wins, wins[static_cast<size_t>(i)]) << i;
+  }
+}
+
+TEST(TemplateMethodExerciseTest, TournamentMatchesCombat) {
+  ExpectTournamentMatchesCombat<TemporaryDamage, TemporaryCardDamageGame>(1);
+  ExpectTournamentMatchesCombat<TemporaryDamage, TemporaryCardDamageGame>(3);
+  ExpectTournamentMatchesCombat<PermanentDamage, PermanentCardDamageGame>(1);
+  ExpectTournamentMatchesCombat<PermanentDamage, PermanentCardDamageGame>(3);
+}
+
 }  // namespace
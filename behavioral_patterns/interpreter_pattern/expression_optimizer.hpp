@@ -0,0 +1,191 @@
+#ifndef BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_EXPRESSION_OPTIMIZER_HPP
+#define BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_EXPRESSION_OPTIMIZER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "interpreter_pattern.hpp"
+
+namespace behavioral {
+namespace interpreter_pattern {
+
+// Number of nodes of an Element tree, counting shared subtrees once per reference.
+inline size_t CountNodes(const Element& element) {
+  if (auto operation = dynamic_cast<const BinaryOperation*>(&element))
+    return 1 + CountNodes(*operation->lhs) + CountNodes(*operation->rhs);
+  return 1;
+}
+
+/**
+ * Successor IR of the Element tree: a DAG stored as a flat list of instructions in topological order.
+ * Children are referenced by index, so every unique subexpression is evaluated exactly once per Eval().
+ *
+ * Compile() runs two passes at once, bottom-up:
+ *  - Constant folding: operations over constants become constants, and x+0, 0+x, x-0 and x-x are simplified.
+ *  - Common-subexpression elimination: structurally identical nodes are hash-consed onto a single instruction.
+ *
+ * Eval() writes into a register file owned by the instance, hence it is non-const; threads evaluating the same
+ * expression concurrently each need their own copy.
+ */
+class OptimizedExpression {
+ public:
+  struct Instruction {
+    enum Op { constant, variable, addition, subtraction } op_;
+    int value_{0};
+    const int* slot_{nullptr};
+    size_t lhs_{0}, rhs_{0};
+  };
+
+  static OptimizedExpression Compile(const Element& root) {
+    OptimizedExpression result;
+    result.root_ = result.Lower(root);
+    result.index_.clear();
+    result.lowered_.clear();
+    result.RemoveDeadInstructions();
+    result.registers_.resize(result.instructions_.size());
+    return result;
+  }
+
+  int Eval() {
+    for (size_t i = 0; i < instructions_.size(); ++i) {
+      const auto& instruction = instructions_[i];
+      switch (instruction.op_) {
+        case Instruction::constant:
+          registers_[i] = instruction.value_;
+          break;
+        case Instruction::variable:
+          registers_[i] = *instruction.slot_;
+          break;
+        case Instruction::addition:
+          registers_[i] = registers_[instruction.lhs_] + registers_[instruction.rhs_];
+          break;
+        case Instruction::subtraction:
+          registers_[i] = registers_[instruction.lhs_] - registers_[instruction.rhs_];
+          break;
+      }
+    }
+    return registers_[root_];
+  }
+
+  size_t NodeCount() const { return instructions_.size(); }
+  const std::vector<Instruction>& Instructions() const { return instructions_; }
+
+ private:
+  struct Key {
+    Instruction::Op op_;
+    int value_;
+    const int* slot_;
+    size_t lhs_, rhs_;
+
+    bool operator==(const Key& other) const {
+      return op_ == other.op_ && value_ == other.value_ && slot_ == other.slot_ && lhs_ == other.lhs_ &&
+             rhs_ == other.rhs_;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t seed = std::hash<int>{}(key.op_);
+      auto combine = [&seed](size_t value) { seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2); };
+      combine(std::hash<int>{}(key.value_));
+      combine(std::hash<const int*>{}(key.slot_));
+      combine(key.lhs_);
+      combine(key.rhs_);
+      return seed;
+    }
+  };
+
+  size_t Emit(const Instruction& instruction) {
+    Key key{instruction.op_, instruction.value_, instruction.slot_, instruction.lhs_, instruction.rhs_};
+    auto it = index_.find(key);
+    if (it != index_.end()) return it->second;
+    instructions_.push_back(instruction);
+    index_.emplace(key, instructions_.size() - 1);
+    return instructions_.size() - 1;
+  }
+
+  size_t EmitConstant(int value) { return Emit(Instruction{Instruction::constant, value, nullptr, 0, 0}); }
+
+  bool IsConstant(size_t index, int value) const {
+    return instructions_[index].op_ == Instruction::constant && instructions_[index].value_ == value;
+  }
+
+  size_t Lower(const Element& element) {
+    auto it = lowered_.find(&element);
+    if (it != lowered_.end()) return it->second;
+    auto index = LowerUncached(element);
+    lowered_.emplace(&element, index);
+    return index;
+  }
+
+  // Folding leaves intermediate constants behind; keep only what the root still reaches, preserving the order.
+  void RemoveDeadInstructions() {
+    std::vector<bool> live(instructions_.size(), false);
+    live[root_] = true;
+    for (size_t i = instructions_.size(); i-- > 0;) {
+      if (!live[i]) continue;
+      auto op = instructions_[i].op_;
+      if (op == Instruction::addition || op == Instruction::subtraction)
+        live[instructions_[i].lhs_] = live[instructions_[i].rhs_] = true;
+    }
+
+    std::vector<size_t> renumbered(instructions_.size());
+    size_t next{0};
+    for (size_t i = 0; i < instructions_.size(); ++i) {
+      if (!live[i]) continue;
+      auto instruction = instructions_[i];
+      instruction.lhs_ = renumbered[instruction.lhs_];
+      instruction.rhs_ = renumbered[instruction.rhs_];
+      renumbered[i] = next;
+      instructions_[next++] = instruction;
+    }
+    instructions_.resize(next);
+    root_ = renumbered[root_];
+  }
+
+  size_t LowerUncached(const Element& element) {
+    if (auto integer = dynamic_cast<const Integer*>(&element)) return EmitConstant(integer->value_);
+    if (auto variable = dynamic_cast<const Variable*>(&element))
+      return Emit(Instruction{Instruction::variable, 0, variable->slot_, 0, 0});
+
+    auto operation = dynamic_cast<const BinaryOperation*>(&element);
+    if (!operation || !operation->lhs || !operation->rhs) throw std::invalid_argument("Unsupported element");
+
+    auto lhs = Lower(*operation->lhs);
+    auto rhs = Lower(*operation->rhs);
+    const auto& left = instructions_[lhs];
+    const auto& right = instructions_[rhs];
+
+    if (operation->type_ == BinaryOperation::addition) {
+      int sum;  // an overflowing fold is left to Eval, as the unoptimized tree would compute it
+      if (left.op_ == Instruction::constant && right.op_ == Instruction::constant &&
+          !__builtin_add_overflow(left.value_, right.value_, &sum))
+        return EmitConstant(sum);
+      if (IsConstant(lhs, 0)) return rhs;
+      if (IsConstant(rhs, 0)) return lhs;
+      return Emit(Instruction{Instruction::addition, 0, nullptr, lhs, rhs});
+    }
+
+    int difference;
+    if (left.op_ == Instruction::constant && right.op_ == Instruction::constant &&
+        !__builtin_sub_overflow(left.value_, right.value_, &difference))
+      return EmitConstant(difference);
+    if (IsConstant(rhs, 0)) return lhs;
+    if (lhs == rhs) return EmitConstant(0);
+    return Emit(Instruction{Instruction::subtraction, 0, nullptr, lhs, rhs});
+  }
+
+  std::vector<Instruction> instructions_;
+  std::unordered_map<Key, size_t, KeyHash> index_;
+  std::unordered_map<const Element*, size_t> lowered_;
+  std::vector<int> registers_;
+  size_t root_{0};
+};
+
+}  // namespace interpreter_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_EXPRESSION_OPTIMIZER_HPP
@@ -0,0 +1,63 @@
+/**
+ * Compares evaluating a raw Element tree with evaluating its OptimizedExpression.
+ * Trees are generated the way machine-written formulas look: a small alphabet of constants and variables,
+ * so the same subexpressions keep reappearing. Node counts before and after optimization are reported as counters.
+ */
+#include <array>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "expression_optimizer.hpp"
+
+namespace {
+
+using namespace behavioral::interpreter_pattern;
+
+std::array<int, 3> variables{{1, 2, 3}};
+
+std::shared_ptr<Element> Generate(int depth, std::mt19937& rng) {
+  if (depth == 0) {
+    if (rng() % 2 == 0) return std::make_shared<Integer>(static_cast<int>(rng() % 4));
+    auto slot = rng() % variables.size();
+    return std::make_shared<Variable>(std::string(1, static_cast<char>('x' + slot)), &variables[slot]);
+  }
+  auto operation = std::make_shared<BinaryOperation>();
+  operation->type_ = rng() % 2 == 0 ? BinaryOperation::addition : BinaryOperation::subtraction;
+  operation->lhs = Generate(depth - 1, rng);
+  operation->rhs = Generate(depth - 1, rng);
+  return operation;
+}
+
+void SetNodeCounters(benchmark::State& state, const Element& tree, const OptimizedExpression& optimized) {
+  state.counters["tree_nodes"] = static_cast<double>(CountNodes(tree));
+  state.counters["dag_nodes"] = static_cast<double>(optimized.NodeCount());
+}
+
+void BM_TreeEval(benchmark::State& state) {
+  std::mt19937 rng{42};
+  auto tree = Generate(static_cast<int>(state.range(0)), rng);
+  for (auto _ : state) benchmark::DoNotOptimize(tree->Eval());
+  SetNodeCounters(state, *tree, OptimizedExpression::Compile(*tree));
+}
+
+void BM_OptimizedEval(benchmark::State& state) {
+  std::mt19937 rng{42};
+  auto tree = Generate(static_cast<int>(state.range(0)), rng);
+  auto optimized = OptimizedExpression::Compile(*tree);
+  for (auto _ : state) benchmark::DoNotOptimize(optimized.Eval());
+  SetNodeCounters(state, *tree, optimized);
+}
+
+void BM_Compile(benchmark::State& state) {
+  std::mt19937 rng{42};
+  auto tree = Generate(static_cast<int>(state.range(0)), rng);
+  for (auto _ : state) benchmark::DoNotOptimize(OptimizedExpression::Compile(*tree).NodeCount());
+}
+
+BENCHMARK(BM_TreeEval)->DenseRange(8, 20, 4);
+BENCHMARK(BM_OptimizedEval)->DenseRange(8, 20, 4);
+BENCHMARK(BM_Compile)->DenseRange(8, 20, 4);
+
+}  // namespace
@@ -0,0 +1,71 @@
+#include <climits>
+#include <memory>
+#include <string>
+
+#include "expression_optimizer.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace behavioral::interpreter_pattern;
+
+std::shared_ptr<Element> Make(BinaryOperation::Type type, std::shared_ptr<Element> lhs, std::shared_ptr<Element> rhs) {
+  auto operation = std::make_shared<BinaryOperation>();
+  operation->type_ = type;
+  operation->lhs = std::move(lhs);
+  operation->rhs = std::move(rhs);
+  return operation;
+}
+
+std::shared_ptr<Element> Add(std::shared_ptr<Element> lhs, std::shared_ptr<Element> rhs) {
+  return Make(BinaryOperation::addition, std::move(lhs), std::move(rhs));
+}
+
+std::shared_ptr<Element> Sub(std::shared_ptr<Element> lhs, std::shared_ptr<Element> rhs) {
+  return Make(BinaryOperation::subtraction, std::move(lhs), std::move(rhs));
+}
+
+std::shared_ptr<Element> Int(int value) { return std::make_shared<Integer>(value); }
+
+TEST(ExpressionOptimizerTest, ParsedExpressionFoldsToSingleConstant) {
+  auto parsed = Parse(Lex("(13-4)-(12+1)"));
+  auto optimized = OptimizedExpression::Compile(*parsed);
+
+  ASSERT_EQ(7u, CountNodes(*parsed));
+  ASSERT_EQ(1u, optimized.NodeCount());
+  ASSERT_EQ(parsed->Eval(), optimized.Eval());
+}
+
+TEST(ExpressionOptimizerTest, IdenticalSubtreesAreSharedAndFolded) {
+  int x{5}, y{2};
+  auto var = [&](const std::string& name) { return std::make_shared<Variable>(name, name == "x" ? &x : &y); };
+
+  // ((x+(1+2)) - y) + ((x+(1+2)) - y) + (y - y)
+  auto tree = Add(Add(Sub(Add(var("x"), Add(Int(1), Int(2))), var("y")),
+                      Sub(Add(var("x"), Add(Int(1), Int(2))), var("y"))),
+                  Sub(var("y"), var("y")));
+  auto optimized = OptimizedExpression::Compile(*tree);
+
+  ASSERT_EQ(19u, CountNodes(*tree));
+  // x, 3, x+3, y, (x+3)-y, sum of the two identical halves; y-y folds to 0 and +0 disappears.
+  ASSERT_EQ(6u, optimized.NodeCount());
+  ASSERT_EQ(tree->Eval(), optimized.Eval());
+
+  x = -10;
+  y = 7;
+  ASSERT_EQ(tree->Eval(), optimized.Eval());
+}
+
+TEST(ExpressionOptimizerTest, OverflowingConstantsAreNotFolded) {
+  ASSERT_EQ(3u, OptimizedExpression::Compile(*Add(Int(INT_MAX), Int(1))).NodeCount());
+  ASSERT_EQ(3u, OptimizedExpression::Compile(*Sub(Int(INT_MIN), Int(1))).NodeCount());
+  ASSERT_EQ(1u, OptimizedExpression::Compile(*Sub(Int(INT_MIN + 1), Int(1))).NodeCount());
+}
+
+TEST(ExpressionOptimizerTest, IncompleteOperationIsRejected) {
+  auto incomplete = std::make_shared<BinaryOperation>();
+  incomplete->lhs = Int(1);
+  ASSERT_THROW(OptimizedExpression::Compile(*incomplete), std::invalid_argument);
+}
+
+}  // namespace
@@ -0,0 +1,183 @@
+#ifndef BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_INTERPRETER_PATTERN_HPP
+#define BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_INTERPRETER_PATTERN_HPP
+
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace behavioral {
+namespace interpreter_pattern {
+
+enum Type { integer, plus, minus, lparen, rparen };
+
+struct Token {
+ public:
+  explicit Token(const Type type, const std::string& text) : type_(type), text_(text) {}
+
+  friend std::ostream& operator<<(std::ostream& os, const Token& token) {
+    os << "`" << token.text_ << "`";
+    return os;
+  }
+
+  std::string GetText() const { return text_; }
+  Type GetType() const { return type_; }
+
+ private:
+  Type type_;
+  std::string text_;
+};
+
+// Lexing -----v
+inline std::vector<Token> Lex(const std::string& input) {
+  std::vector<Token> result{};
+
+  for (unsigned int i = 0; i < input.size(); ++i) {
+    switch (input[i]) {
+      case '+':
+        result.push_back(Token{Type::plus, "+"});
+        break;
+      case '-':
+        result.push_back(Token{Type::minus, "-"});
+        break;
+      case '(':
+        result.push_back(Token{Type::lparen, "("});
+        break;
+      case ')':
+        result.push_back(Token{Type::rparen, ")"});
+        break;
+      default:
+        std::ostringstream buffer;
+        buffer << input[i];
+        for (unsigned int j = i + 1; input.size(); j++) {
+          if (isdigit(input[j])) {
+            buffer << input[j];
+            ++i;
+          } else {
+            result.push_back(Token{Type::integer, buffer.str()});
+            break;
+          }
+        }
+    }
+  }
+  return result;
+}
+
+// Parsing -----v
+struct Element {
+  virtual int Eval() const = 0;
+};
+
+struct Integer : public Element {
+  int value_;
+
+  Integer(int value) : value_(value) {}
+
+  int Eval() const override { return value_; }
+};
+
+// Reads its value from an external slot, so one tree can be re-evaluated against changing inputs.
+struct Variable : public Element {
+  std::string name_;
+  const int* slot_;
+
+  Variable(const std::string& name, const int* slot) : name_(name), slot_(slot) {}
+
+  int Eval() const override { return *slot_; }
+};
+
+struct BinaryOperation : public Element {
+  enum Type { addition, subtraction } type_;
+  std::shared_ptr<Element> lhs, rhs;
+
+  int Eval() const override {
+    auto left = lhs->Eval();
+    auto right = rhs->Eval();
+    if (type_ == addition) return left + right;
+    return left - right;
+  }
+};
+
+// Nodes are allocated from `resource`, e.g. a per-thread arena; it must outlive the returned tree.
+inline std::shared_ptr<Element> Parse(const std::vector<Token>& tokens,
+                                      std::pmr::memory_resource* resource = std::pmr::new_delete_resource()) {
+  std::pmr::polymorphic_allocator<Element> allocator{resource};
+  auto result = std::allocate_shared<BinaryOperation>(allocator);
+  bool have_lhs{false};
+  bool have_operator{false};
+  bool expect_operand{true};  // operands and operators must alternate, starting with an operand
+
+  // a chain like 1+2-3 is left-associative: ((1+2)-3)
+  auto chain = [&result, &allocator]() {
+    if (!result->rhs) return;
+    auto chained = std::allocate_shared<BinaryOperation>(allocator);
+    chained->lhs = result;
+    result = chained;
+  };
+
+  for (unsigned int i = 0; i < tokens.size(); ++i) {
+    auto token = tokens[i];
+    switch (token.GetType()) {
+      case Type::integer: {
+        if (!expect_operand) throw std::invalid_argument("Missing operator before " + token.GetText());
+        expect_operand = false;
+        int value = std::stoi(token.GetText());
+        auto integer = std::allocate_shared<Integer>(allocator, value);
+        if (!have_lhs) {
+          result->lhs = integer;
+          have_lhs = true;
+        } else
+          result->rhs = integer;
+        break;
+      }
+      case Type::plus:
+        if (expect_operand) throw std::invalid_argument("Missing operand before " + token.GetText());
+        expect_operand = true;
+        chain();
+        result->type_ = BinaryOperation::addition;
+        have_operator = true;
+        break;
+      case Type::minus:
+        if (expect_operand) throw std::invalid_argument("Missing operand before " + token.GetText());
+        expect_operand = true;
+        chain();
+        result->type_ = BinaryOperation::subtraction;
+        have_operator = true;
+        break;
+      case Type::lparen: {
+        if (!expect_operand) throw std::invalid_argument("Missing operator before (");
+        expect_operand = false;
+        unsigned int j = i;
+        int depth{0};
+        for (; j < tokens.size(); ++j) {
+          if (tokens[j].GetType() == Type::lparen) ++depth;
+          if (tokens[j].GetType() == Type::rparen && --depth == 0) break;  // found it!
+        }
+        if (j == tokens.size()) throw std::invalid_argument("Unbalanced parentheses");
+
+        std::vector<Token> subexpression(&tokens[i + 1], &tokens[j]);
+        auto element = Parse(subexpression, resource);
+        if (!have_lhs) {
+          result->lhs = element;
+          have_lhs = true;
+        } else
+          result->rhs = element;
+        i = j;  // advance
+      } break;
+      case Type::rparen:
+        throw std::invalid_argument("Unbalanced parentheses");
+    }
+  }
+  if (expect_operand) throw std::invalid_argument("Missing operand at end of expression");  // also "" and "()"
+  if (!have_operator) return result->lhs;  // a lone operand, e.g. "5" or "(1+2)"
+  return result;
+}
+
+}  // namespace interpreter_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_INTERPRETER_PATTERN_HPP
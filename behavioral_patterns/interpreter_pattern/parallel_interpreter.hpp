@@ -0,0 +1,92 @@
+#ifndef BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_PARALLEL_INTERPRETER_HPP
+#define BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_PARALLEL_INTERPRETER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "behavioral_patterns/common/joining_threads.hpp"
+#include "streaming_interpreter.hpp"
+
+namespace behavioral {
+namespace interpreter_pattern {
+
+// Splits `input` into pieces of roughly `chunk_size` bytes, each ending right after a newline (or at the end).
+inline std::vector<std::string_view> SplitIntoChunks(std::string_view input, size_t chunk_size) {
+  if (chunk_size == 0) throw std::invalid_argument("chunk_size must be positive");
+
+  std::vector<std::string_view> chunks;
+  size_t begin{0};
+  while (begin < input.size()) {
+    size_t end = std::min(begin + chunk_size, input.size());
+    if (end < input.size()) {
+      auto newline = input.find('\n', end - 1);
+      end = newline == std::string_view::npos ? input.size() : newline + 1;
+    }
+    chunks.push_back(input.substr(begin, end - begin));
+    begin = end;
+  }
+  return chunks;
+}
+
+/**
+ * Evaluates newline separated, independent expressions on `threads` workers.
+ * Workers claim chunks from a shared counter, so a slow chunk never stalls the others. Each worker parses into its
+ * own monotonic arena, released after every chunk, so node allocation never contends on the global heap.
+ * Results are returned in input order, one entry per non-empty line; std::nullopt marks a malformed expression.
+ * If a worker throws (e.g. std::bad_alloc), the others stop claiming chunks and the exception is rethrown here once
+ * every thread has finished.
+ */
+inline std::vector<std::optional<int>> EvaluateParallel(std::string_view input, size_t threads,
+                                                        size_t chunk_size = 1 << 16) {
+  if (threads == 0) throw std::invalid_argument("threads must be positive");
+
+  auto chunks = SplitIntoChunks(input, chunk_size);
+  std::vector<std::vector<std::optional<int>>> chunk_results(chunks.size());
+  std::atomic<size_t> next_chunk{0};
+
+  auto workers = std::max<size_t>(1, std::min(threads, chunks.size()));
+  std::vector<std::exception_ptr> errors(workers);
+
+  auto worker = [&](size_t self) {
+    try {
+      std::pmr::monotonic_buffer_resource arena;
+      StreamingLexer lexer;
+      for (size_t chunk = next_chunk++; chunk < chunks.size(); chunk = next_chunk++) {
+        auto& results = chunk_results[chunk];
+        auto evaluate = [&](const std::vector<Token>& tokens, bool malformed) {
+          results.push_back(EvaluateTokens(tokens, malformed, &arena));
+        };
+        lexer.Feed(chunks[chunk].data(), chunks[chunk].size(), evaluate);
+        lexer.Finish(evaluate);
+        arena.release();
+      }
+    } catch (...) {
+      errors[self] = std::current_exception();
+      next_chunk = chunks.size();  // the other workers stop after their current chunk
+    }
+  };
+
+  {
+    common::JoiningThreads pool{workers - 1};
+    for (size_t i = 1; i < workers; ++i) pool.Start(worker, i);
+    worker(0);
+  }
+  for (auto& error : errors)
+    if (error) std::rethrow_exception(error);
+
+  std::vector<std::optional<int>> results;
+  for (auto& chunk : chunk_results) results.insert(results.end(), chunk.begin(), chunk.end());
+  return results;
+}
+
+}  // namespace interpreter_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_PARALLEL_INTERPRETER_HPP
@@ -0,0 +1,38 @@
+/**
+ * Scaling of EvaluateParallel() with the number of worker threads on one million generated expressions.
+ * Wall-clock time is measured, since the work happens on threads other than the benchmark's own.
+ */
+#include <random>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "parallel_interpreter.hpp"
+
+namespace {
+
+using namespace behavioral::interpreter_pattern;
+
+const std::string& Input() {
+  static const std::string text = [] {
+    std::mt19937 rng{7};
+    std::string generated;
+    for (int i = 0; i < 1000000; ++i) {
+      generated += "(" + std::to_string(rng() % 1000) + "-" + std::to_string(rng() % 1000) + ")-(";
+      generated += std::to_string(rng() % 1000) + "+" + std::to_string(rng() % 1000) + ")\n";
+    }
+    return generated;
+  }();
+  return text;
+}
+
+void BM_EvaluateParallel(benchmark::State& state) {
+  const auto& input = Input();
+  auto threads = static_cast<size_t>(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(EvaluateParallel(input, threads).size());
+  state.SetItemsProcessed(state.iterations() * 1000000);
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(input.size()));
+}
+
+BENCHMARK(BM_EvaluateParallel)->RangeMultiplier(2)->Range(1, 16)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,54 @@
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "parallel_interpreter.hpp"
+
+namespace {
+
+using namespace behavioral::interpreter_pattern;
+
+TEST(ParallelInterpreterTest, ChunksEndOnLineBoundaries) {
+  auto chunks = SplitIntoChunks("1+1\n22+22\n3\n", 2);
+
+  ASSERT_EQ((std::vector<std::string_view>{"1+1\n", "22+22\n", "3\n"}), chunks);
+  ASSERT_TRUE(SplitIntoChunks("", 4).empty());
+}
+
+TEST(ParallelInterpreterTest, ResultsKeepInputOrder) {
+  std::string input;
+  std::vector<std::optional<int>> expected;
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 97 == 0) {
+      input += "(" + std::to_string(i) + "\n";
+      expected.push_back(std::nullopt);
+    } else {
+      input += std::to_string(i) + "-(" + std::to_string(i) + "-1)+" + std::to_string(i) + "\n";
+      expected.push_back(i + 1);
+    }
+  }
+
+  for (size_t threads : {1u, 3u, 8u}) {
+    for (size_t chunk_size : {1u, 64u, 1u << 16}) {
+      ASSERT_EQ(expected, EvaluateParallel(input, threads, chunk_size))
+          << "threads=" << threads << " chunk_size=" << chunk_size;
+    }
+  }
+}
+
+TEST(ParallelInterpreterTest, MatchesStreamingEvaluation) {
+  std::string input{"1+2\n\n(5-7)+1\nx\n4-(3-(2-1))"};
+  std::istringstream stream{input};
+  std::vector<std::optional<int>> streamed;
+  auto stats = EvaluateStream(stream, [&](size_t index, int value) {
+    streamed.resize(index + 1);
+    streamed[index] = value;
+  });
+  streamed.resize(stats.expressions);
+
+  ASSERT_EQ(streamed, EvaluateParallel(input, 2, 4));
+}
+
+}  // namespace
@@ -0,0 +1,147 @@
+#ifndef BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_STREAMING_INTERPRETER_HPP
+#define BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_STREAMING_INTERPRETER_HPP
+
+#include <cctype>
+#include <chrono>
+#include <cstddef>
+#include <istream>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "interpreter_pattern.hpp"
+
+namespace behavioral {
+namespace interpreter_pattern {
+
+/**
+ * Incremental version of Lex() for newline separated expressions.
+ * Input is fed in arbitrary chunks; the lexer keeps a partially read integer across chunk boundaries and hands
+ * the tokens of every completed line to a callback. Only the tokens of the current line are ever held in memory.
+ */
+class StreamingLexer {
+ public:
+  template <typename OnExpression>
+  void Feed(const char* data, size_t size, OnExpression&& on_expression) {
+    for (size_t i = 0; i < size; ++i) {
+      char c = data[i];
+      if (std::isdigit(static_cast<unsigned char>(c))) {
+        digits_ += c;
+        continue;
+      }
+      FlushInteger();
+      switch (c) {
+        case '+':
+          tokens_.push_back(Token{Type::plus, "+"});
+          break;
+        case '-':
+          tokens_.push_back(Token{Type::minus, "-"});
+          break;
+        case '(':
+          tokens_.push_back(Token{Type::lparen, "("});
+          break;
+        case ')':
+          tokens_.push_back(Token{Type::rparen, ")"});
+          break;
+        case '\n':
+          EndLine(on_expression);
+          break;
+        default:
+          if (!std::isspace(static_cast<unsigned char>(c))) malformed_ = true;
+      }
+    }
+  }
+
+  // Emits the last expression if the input did not end with a newline.
+  template <typename OnExpression>
+  void Finish(OnExpression&& on_expression) {
+    FlushInteger();
+    if (!tokens_.empty() || malformed_) EndLine(on_expression);
+  }
+
+ private:
+  void FlushInteger() {
+    if (digits_.empty()) return;
+    tokens_.push_back(Token{Type::integer, digits_});
+    digits_.clear();
+  }
+
+  // on_expression(tokens, malformed) is called for every non-empty line.
+  template <typename OnExpression>
+  void EndLine(OnExpression&& on_expression) {
+    if (!tokens_.empty() || malformed_) on_expression(tokens_, malformed_);
+    tokens_.clear();
+    malformed_ = false;
+  }
+
+  std::vector<Token> tokens_;
+  std::string digits_;
+  bool malformed_{false};
+};
+
+// Parses and evaluates the tokens of one line; std::nullopt if the line is malformed.
+inline std::optional<int> EvaluateTokens(const std::vector<Token>& tokens, bool malformed,
+                                         std::pmr::memory_resource* resource = std::pmr::new_delete_resource()) {
+  if (malformed) return std::nullopt;
+  try {
+    return Parse(tokens, resource)->Eval();
+  } catch (const std::exception&) {
+    // Parse() rejects malformed lines and std::stoi integers that do not fit.
+  }
+  return std::nullopt;
+}
+
+struct StreamStatistics {
+  size_t expressions{0};
+  size_t failures{0};
+  size_t bytes{0};
+  std::chrono::duration<double> elapsed{0};
+
+  double ExpressionsPerSecond() const {
+    return elapsed.count() > 0 ? static_cast<double>(expressions) / elapsed.count() : 0;
+  }
+};
+
+/**
+ * Reads `input` through a fixed buffer of `chunk_size` bytes, lexing, parsing and evaluating one line at a time.
+ * `on_result(index, value)` receives the zero-based line index (empty lines excluded) of every expression that
+ * evaluated successfully; malformed expressions are only counted in StreamStatistics::failures.
+ */
+template <typename OnResult>
+StreamStatistics EvaluateStream(std::istream& input, OnResult&& on_result, size_t chunk_size = 1 << 16) {
+  if (chunk_size == 0) throw std::invalid_argument("chunk_size must be positive");
+
+  StreamStatistics statistics;
+  StreamingLexer lexer;
+  std::vector<char> buffer(chunk_size);
+  size_t index{0};
+
+  auto evaluate = [&](const std::vector<Token>& tokens, bool malformed) {
+    auto current = index++;
+    ++statistics.expressions;
+    if (auto value = EvaluateTokens(tokens, malformed))
+      on_result(current, *value);
+    else
+      ++statistics.failures;
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  while (input) {
+    input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    auto read = static_cast<size_t>(input.gcount());
+    if (read == 0) break;
+    statistics.bytes += read;
+    lexer.Feed(buffer.data(), read, evaluate);
+  }
+  lexer.Finish(evaluate);
+  statistics.elapsed = std::chrono::steady_clock::now() - start;
+  return statistics;
+}
+
+}  // namespace interpreter_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_INTERPRETER_PATTERN_STREAMING_INTERPRETER_HPP
@@ -0,0 +1,57 @@
+/**
+ * Expressions per second of EvaluateStream() versus reading every line with std::getline and calling Lex/Parse.
+ * The input is generated in memory once; the stream only ever sees it through a fixed-size read buffer.
+ */
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "streaming_interpreter.hpp"
+
+namespace {
+
+using namespace behavioral::interpreter_pattern;
+
+std::string GenerateLines(size_t count) {
+  std::mt19937 rng{7};
+  std::string text;
+  for (size_t i = 0; i < count; ++i) {
+    text += "(" + std::to_string(rng() % 1000) + "-" + std::to_string(rng() % 1000) + ")";
+    text += rng() % 2 == 0 ? "+" : "-";
+    text += std::to_string(rng() % 1000) + "+" + std::to_string(rng() % 1000) + "\n";
+  }
+  return text;
+}
+
+void BM_EvaluateStream(benchmark::State& state) {
+  auto text = GenerateLines(static_cast<size_t>(state.range(0)));
+  auto chunk_size = static_cast<size_t>(state.range(1));
+  long long checksum{0};
+  for (auto _ : state) {
+    std::istringstream input{text};
+    auto stats = EvaluateStream(input, [&checksum](size_t, int value) { checksum += value; }, chunk_size);
+    state.counters["failures"] = static_cast<double>(stats.failures);
+  }
+  benchmark::DoNotOptimize(checksum);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(text.size()));
+}
+
+void BM_GetlineLexParse(benchmark::State& state) {
+  auto text = GenerateLines(static_cast<size_t>(state.range(0)));
+  long long checksum{0};
+  for (auto _ : state) {
+    std::istringstream input{text};
+    std::string line;
+    while (std::getline(input, line)) checksum += Parse(Lex(line))->Eval();
+  }
+  benchmark::DoNotOptimize(checksum);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * static_cast<long long>(text.size()));
+}
+
+BENCHMARK(BM_EvaluateStream)->Args({100000, 4 << 10})->Args({100000, 64 << 10})->Args({100000, 1 << 20});
+BENCHMARK(BM_GetlineLexParse)->Arg(100000);
+
+}  // namespace
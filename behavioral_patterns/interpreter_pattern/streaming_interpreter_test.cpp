@@ -0,0 +1,53 @@
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "streaming_interpreter.hpp"
+
+namespace {
+
+using namespace behavioral::interpreter_pattern;
+
+std::vector<std::pair<size_t, int>> EvaluateAll(const std::string& text, size_t chunk_size, StreamStatistics& stats) {
+  std::istringstream input{text};
+  std::vector<std::pair<size_t, int>> results;
+  stats = EvaluateStream(input, [&](size_t index, int value) { results.emplace_back(index, value); }, chunk_size);
+  return results;
+}
+
+TEST(StreamingInterpreterTest, ResultsDoNotDependOnChunkSize) {
+  std::string text{"(13-4)-(12+1)\n1+2+3\n\n100-(20-(3-1))\r\n42"};
+  std::vector<std::pair<size_t, int>> expected{{0, -4}, {1, 6}, {2, 82}, {3, 42}};
+
+  for (size_t chunk_size : {1u, 2u, 3u, 7u, 4096u}) {
+    StreamStatistics stats;
+    ASSERT_EQ(expected, EvaluateAll(text, chunk_size, stats)) << "chunk_size=" << chunk_size;
+    ASSERT_EQ(4u, stats.expressions);
+    ASSERT_EQ(0u, stats.failures);
+    ASSERT_EQ(text.size(), stats.bytes);
+  }
+}
+
+TEST(StreamingInterpreterTest, MalformedLinesAreCountedAndSkipped) {
+  StreamStatistics stats;
+  auto results = EvaluateAll("1+\nx+1\n(2+3\n99999999999\n()\n7-2\n", 4, stats);
+
+  ASSERT_EQ((std::vector<std::pair<size_t, int>>{{5, 5}}), results);
+  ASSERT_EQ(6u, stats.expressions);
+  ASSERT_EQ(5u, stats.failures);
+}
+
+TEST(StreamingInterpreterTest, MisplacedTokensAreFailures) {
+  for (auto line : {"12 34", "1+2 3", "1+2)", "1++2", "+1", "(1)(2)", "3(1+2)", ")"})
+    ASSERT_FALSE(EvaluateTokens(Lex(line), false)) << line;
+  ASSERT_EQ(-1, EvaluateTokens(Lex("1-(2)"), false));
+
+  StreamStatistics stats;
+  auto results = EvaluateAll("12 34\n1+2 3\n1+2)\n1++2\n4\n", 3, stats);
+  ASSERT_EQ((std::vector<std::pair<size_t, int>>{{4, 4}}), results);
+  ASSERT_EQ(4u, stats.failures);
+}
+
+}  // namespace
@@ -0,0 +1,327 @@
+#ifndef BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_BINARY_TREE_HPP
+#define BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_BINARY_TREE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace behavioral {
+namespace iterator_pattern {
+
+/**
+ *        A
+ *      /   \
+ *     B     C
+ */
+template <typename T>
+struct BinaryTree;
+
+template <typename T>
+struct Node {
+  T value_ = T();
+  Node<T>*left_{nullptr}, *right_{nullptr}, *parent_{nullptr};
+  BinaryTree<T>* tree_{nullptr};
+
+  Node(T value) : value_(value) {}
+
+  Node(T value, Node<T>* left, Node<T>* right) : value_(value), left_(left), right_(right) {
+    this->right_->tree_ = this->left_->tree_ = tree_;
+    this->right_->parent_ = this->left_->parent_ = this;
+  }
+
+  void SetTree(BinaryTree<T>* t) {
+    std::vector<Node<T>*> pending{this};
+    while (!pending.empty()) {
+      auto node = pending.back();
+      pending.pop_back();
+      node->tree_ = t;
+      if (node->left_) pending.push_back(node->left_);
+      if (node->right_) pending.push_back(node->right_);
+    }
+  }
+
+  // Deletes the whole subtree without recursing, so degenerate trees of any depth can be destroyed. Detached nodes
+  // are chained through their parent_ links while waiting, which needs no extra memory.
+  ~Node() {
+    Node<T>* pending{nullptr};
+    auto detach = [&pending](Node<T>*& child) {
+      if (!child) return;
+      child->parent_ = pending;
+      pending = std::exchange(child, nullptr);
+    };
+    detach(left_);
+    detach(right_);
+    while (pending) {
+      auto node = pending;
+      pending = node->parent_;
+      detach(node->left_);
+      detach(node->right_);
+      delete node;
+    }
+  }
+};
+
+/**
+ * Arena for the nodes of one tree. Nodes are carved out of blocks of `block_size` nodes, so creating one is a
+ * pointer bump, and the whole tree is freed block by block instead of node by node: for trivially destructible
+ * values no node is touched at all. Nodes of a pool must never be deleted individually.
+ */
+template <typename T>
+class NodePool {
+ public:
+  explicit NodePool(size_t block_size = 4096) : block_size_(block_size ? block_size : 1) {}
+
+  NodePool(NodePool&& other) noexcept
+      : blocks_(std::move(other.blocks_)),
+        block_size_(other.block_size_),
+        used_(std::exchange(other.used_, other.block_size_)),
+        size_(std::exchange(other.size_, 0)) {}
+  NodePool& operator=(NodePool&& other) noexcept {
+    if (this != &other) {
+      Release();
+      blocks_ = std::move(other.blocks_);
+      block_size_ = other.block_size_;
+      used_ = std::exchange(other.used_, other.block_size_);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+  NodePool(const NodePool&) = delete;
+  NodePool& operator=(const NodePool&) = delete;
+
+  ~NodePool() { Release(); }
+
+  template <typename... Args>
+  Node<T>* Create(Args&&... args) {
+    if (used_ == block_size_) {
+      blocks_.push_back(std::make_unique<Slot[]>(block_size_));
+      used_ = 0;
+    }
+    auto node = new (&blocks_.back()[used_]) Node<T>(std::forward<Args>(args)...);
+    ++used_;
+    ++size_;
+    return node;
+  }
+
+  size_t size() const { return size_; }
+
+  // Destroys every node created so far.
+  void Release() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      for (size_t block = 0; block < blocks_.size(); ++block) {
+        auto count = block + 1 == blocks_.size() ? used_ : block_size_;
+        for (size_t i = 0; i < count; ++i) {
+          auto node = std::launder(reinterpret_cast<Node<T>*>(&blocks_[block][i]));
+          node->left_ = node->right_ = nullptr;  // the pool owns the children, not the node
+          node->~Node();
+        }
+      }
+    }
+    blocks_.clear();
+    used_ = block_size_;
+    size_ = 0;
+  }
+
+ private:
+  struct alignas(Node<T>) Slot {
+    unsigned char bytes_[sizeof(Node<T>)];
+  };
+
+  std::vector<std::unique_ptr<Slot[]>> blocks_;
+  size_t block_size_;
+  size_t used_{block_size_};  // nodes taken from the last block
+  size_t size_{0};
+};
+
+template <typename T>
+struct BinaryTree {
+  Node<T>* root_{nullptr};
+  NodePool<T> pool_;  // owns every node when the tree was built from a pool
+
+  BinaryTree(Node<T>* root) : root_(root) {
+    if (root_) root_->SetTree(this);
+  }
+
+  // Takes over a pool holding `root` and all of its descendants; the tree is freed together with the pool.
+  BinaryTree(Node<T>* root, NodePool<T> pool) : root_(root), pool_(std::move(pool)) {
+    if (root_) root_->SetTree(this);
+  }
+
+  BinaryTree(const BinaryTree&) = delete;
+  BinaryTree& operator=(const BinaryTree&) = delete;
+
+  ~BinaryTree() {
+    if (root_ && pool_.size() == 0) delete root_;
+  }
+
+  /**
+   * Successor functions of the four traversal orders. They only follow left_, right_ and parent_ links,
+   * so iterating needs no stack, queue or allocation: an iterator is a node pointer (plus its depth for level order).
+   * Nodes linked by hand must therefore have their parent_ set as well.
+   */
+  struct PreOrderTraversal {
+    static Node<T>* First(Node<T>* root) { return root; }
+    static void Next(Node<T>*& node, size_t&) {
+      if (node->left_) {
+        node = node->left_;
+        return;
+      }
+      if (node->right_) {
+        node = node->right_;
+        return;
+      }
+      for (auto p = node->parent_; p; node = p, p = p->parent_) {
+        if (node == p->left_ && p->right_) {
+          node = p->right_;
+          return;
+        }
+      }
+      node = nullptr;
+    }
+  };
+
+  struct InOrderTraversal {
+    static Node<T>* First(Node<T>* root) {
+      if (root)
+        while (root->left_) root = root->left_;
+      return root;
+    }
+    static void Next(Node<T>*& node, size_t&) {
+      if (node->right_) {
+        node = First(node->right_);
+        return;
+      }
+      Node<T>* p = node->parent_;
+      while (p && node == p->right_) {
+        node = p;
+        p = p->parent_;
+      }
+      node = p;
+    }
+  };
+
+  struct PostOrderTraversal {
+    // Descends to the first node of the subtree in post-order, preferring left children.
+    static Node<T>* First(Node<T>* root) {
+      while (root && (root->left_ || root->right_)) root = root->left_ ? root->left_ : root->right_;
+      return root;
+    }
+    static void Next(Node<T>*& node, size_t&) {
+      auto p = node->parent_;
+      if (p && node == p->left_ && p->right_)
+        node = First(p->right_);
+      else
+        node = p;
+    }
+  };
+
+  // Breadth-first without a queue: the next node of a level is found by climbing to the nearest ancestor with an
+  // unexplored right subtree and descending again. O(1) space; amortised O(1) time per node on balanced trees.
+  struct LevelOrderTraversal {
+    static Node<T>* First(Node<T>* root) { return root; }
+    static void Next(Node<T>*& node, size_t& depth) {
+      size_t climbed{0};
+      while (node->parent_) {
+        auto p = node->parent_;
+        ++climbed;
+        if (node == p->left_ && p->right_) {
+          if (auto found = LeftmostAtDepth(p->right_, climbed - 1)) {
+            node = found;
+            return;
+          }
+        }
+        node = p;
+      }
+      node = LeftmostAtDepth(node, ++depth);  // node is the root now; start the next level
+    }
+
+    // Leftmost node exactly `depth` levels below `subtree`, found by a depth-bounded walk over parent links.
+    static Node<T>* LeftmostAtDepth(Node<T>* subtree, size_t depth) {
+      auto node = subtree;
+      size_t level{0};
+      while (level != depth) {
+        if (node->left_ || node->right_) {
+          node = node->left_ ? node->left_ : node->right_;
+          ++level;
+          continue;
+        }
+        while (true) {  // dead end above `depth`: backtrack to the next unexplored right subtree
+          if (node == subtree) return nullptr;
+          auto p = node->parent_;
+          --level;
+          if (node == p->left_ && p->right_) {
+            node = p->right_;
+            ++level;
+            break;
+          }
+          node = p;
+        }
+      }
+      return node;
+    }
+  };
+
+  template <typename Traversal>
+  struct Iterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Node<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Node<T>*;
+    using reference = Node<T>&;
+
+    Node<T>* current_{nullptr};
+    size_t depth_{0};
+
+    Iterator() = default;
+    Iterator(Node<T>* current) : current_(current) {}
+
+    bool operator==(const Iterator& other) const { return current_ == other.current_; }
+    bool operator!=(const Iterator& other) const { return current_ != other.current_; }
+
+    Iterator& operator++() {
+      Traversal::Next(current_, depth_);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    Node<T>& operator*() const { return *current_; }
+    Node<T>* operator->() const { return current_; }
+  };
+
+  template <typename Traversal>
+  struct Range {
+    Node<T>* root_;
+
+    Iterator<Traversal> begin() const { return Iterator<Traversal>{Traversal::First(root_)}; }
+    Iterator<Traversal> end() const { return Iterator<Traversal>{nullptr}; }
+  };
+
+  using PreOrderIterator = Iterator<PreOrderTraversal>;
+  using InOrderIterator = Iterator<InOrderTraversal>;
+  using PostOrderIterator = Iterator<PostOrderTraversal>;
+  using LevelOrderIterator = Iterator<LevelOrderTraversal>;
+
+  Range<PreOrderTraversal> PreOrder() const { return {root_}; }
+  Range<InOrderTraversal> InOrder() const { return {root_}; }
+  Range<PostOrderTraversal> PostOrder() const { return {root_}; }
+  Range<LevelOrderTraversal> LevelOrder() const { return {root_}; }
+
+  // Iterating the tree itself visits it in pre-order.
+  typedef PreOrderIterator iterator;
+  iterator begin() { return iterator{root_}; }
+  iterator end() { return iterator{nullptr}; }
+};
+
+}  // namespace iterator_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_BINARY_TREE_HPP
@@ -1,95 +1,10 @@
+#include <algorithm>
+#include <iostream>
+#include <iterator>
 #include <string>
+#include <vector>
 
-namespace behavioral {
-namespace iterator_pattern {
-
-/**
- *        A
- *      /   \
- *     B     C
- */
-template <typename T>
-struct BinaryTree;
-
-template <typename T>
-struct Node {
-  T value_ = T();
-  Node<T>*left_{nullptr}, *right_{nullptr}, *parent_{nullptr};
-  BinaryTree<T>* tree_{nullptr};
-
-  Node(T value) : value_(value) {}
-
-  Node(T value, Node<T>* left, Node<T>* right) : value_(value), left_(left), right_(right) {
-    this->right_->tree_ = this->left_->tree_ = tree_;
-    this->right_->parent_ = this->left_->parent_ = this;
-  }
-
-  void SetTree(BinaryTree<T>* t) {
-    tree_ = t;
-    if (left_) left_->SetTree(t);
-    if (right_) right_->SetTree(t);
-  }
-
-  ~Node() {
-    if (left_) delete left_;
-    if (right_) delete right_;
-  }
-};
-
-template <typename T>
-struct BinaryTree {
-  Node<T>* root_{nullptr};
-
-  BinaryTree(Node<T>* root) : root_(root) { root->SetTree(this); }
-
-  ~BinaryTree() {
-    if (root_) delete root_;
-  }
-
-  // Iterator for Binary Tree
-  template <typename U>
-  struct PreOrderIterator {
-    Node<U>* current_;
-    PreOrderIterator(Node<U>* current) : current_(current) {}
-
-    bool operator!=(const PreOrderIterator<U>& other) { return current_ != other.current_; }
-
-    PreOrderIterator<U>& operator++() {
-      if (current_->right_) {
-        current_ = current_->right_;
-        while (current_->left_) {
-          current_ = current_->left_;
-        }
-      } else {
-        Node<T>* p = current_->parent_;
-        while (p && current_ == p->right_) {
-          current_ = p;
-          p = p->parent_;
-        }
-        current_ = p;
-      }
-      return *this;
-    }
-
-    Node<U>& operator*() { return *current_; }
-  };  // PreOrderIterator
-
-  typedef PreOrderIterator<T> iterator;
-  iterator begin() {
-    Node<T>* n = root_;
-    if (n) {
-      while (n->left_) {
-        n = n->left_;
-      }
-    }
-    return iterator{nullptr};
-  }
-
-  iterator end() { return iterator{nullptr}; }
-};
-
-}  // namespace iterator_pattern
-}  // namespace behavioral
+#include "binary_tree.hpp"
 
 // TEST---------------------------------------------------------------------------------------------------------------|
 
@@ -99,6 +14,13 @@ namespace {
 
 using namespace behavioral::iterator_pattern;
 
+template <typename Range>
+std::vector<std::string> Names(const Range& range) {
+  std::vector<std::string> names;
+  for (auto& node : range) names.push_back(node.value_);
+  return names;
+}
+
 TEST(IteratorPatternTest, IteratorsInTheStandardTemplateLibrary) {
   /**
    *            Me
@@ -116,6 +38,106 @@ TEST(IteratorPatternTest, IteratorsInTheStandardTemplateLibrary) {
   for (auto it = family.begin(); it != family.end(); ++it) {
     std::cout << (*it).value_ << std::endl;
   }
+
+  ASSERT_EQ((std::vector<std::string>{"Me", "Mother", "Mother's mother", "Mother's father", "Father"}),
+            Names(family.PreOrder()));
+  ASSERT_EQ((std::vector<std::string>{"Mother's mother", "Mother", "Mother's father", "Me", "Father"}),
+            Names(family.InOrder()));
+  ASSERT_EQ((std::vector<std::string>{"Mother's mother", "Mother's father", "Mother", "Father", "Me"}),
+            Names(family.PostOrder()));
+  ASSERT_EQ((std::vector<std::string>{"Me", "Mother", "Father", "Mother's mother", "Mother's father"}),
+            Names(family.LevelOrder()));
+}
+
+TEST(IteratorPatternTest, RaggedTreeInEveryOrder) {
+  /**
+   *          a
+   *        /   \
+   *       b     c
+   *        \     \
+   *         d     e
+   *        /     / \
+   *       f     g   h
+   */
+  auto link = [](Node<std::string>* parent, Node<std::string>* left, Node<std::string>* right) {
+    parent->left_ = left;
+    parent->right_ = right;
+    if (left) left->parent_ = parent;
+    if (right) right->parent_ = parent;
+    return parent;
+  };
+  using N = Node<std::string>;
+  BinaryTree<std::string> tree{
+      link(new N{"a"}, link(new N{"b"}, nullptr, link(new N{"d"}, new N{"f"}, nullptr)),
+           link(new N{"c"}, nullptr, link(new N{"e"}, new N{"g"}, new N{"h"})))};
+
+  auto joined = [](const std::vector<std::string>& names) {
+    std::string result;
+    for (auto& name : names) result += name;
+    return result;
+  };
+  ASSERT_EQ("abdfcegh", joined(Names(tree.PreOrder())));
+  ASSERT_EQ("bfdacgeh", joined(Names(tree.InOrder())));
+  ASSERT_EQ("fdbgheca", joined(Names(tree.PostOrder())));
+  ASSERT_EQ("abcdefgh", joined(Names(tree.LevelOrder())));
+}
+
+TEST(IteratorPatternTest, WorksWithStandardAlgorithms) {
+  BinaryTree<int> tree{new Node<int>{1, new Node<int>{2, new Node<int>{4}, new Node<int>{5}}, new Node<int>{3}}};
+
+  auto level_order = tree.LevelOrder();
+  ASSERT_EQ(5, std::distance(level_order.begin(), level_order.end()));
+  ASSERT_EQ(2, std::count_if(level_order.begin(), level_order.end(), [](auto& n) { return n.value_ % 2 == 0; }));
+
+  auto post_order = tree.PostOrder();
+  auto found = std::find_if(post_order.begin(), post_order.end(), [](auto& n) { return n.value_ == 2; });
+  ASSERT_EQ(3, std::next(found)->value_);
+
+  BinaryTree<int> empty{nullptr};
+  ASSERT_TRUE(empty.begin() == empty.end());
+  ASSERT_TRUE(empty.LevelOrder().begin() == empty.LevelOrder().end());
+  ASSERT_TRUE(empty.PostOrder().begin() == empty.PostOrder().end());
+}
+
+TEST(IteratorPatternTest, DegenerateTreeIsDestroyedIteratively) {
+  const int depth{1000000};  // far deeper than a recursive destructor could go
+  auto root = new Node<int>{0};
+  auto current = root;
+  for (int i = 1; i < depth; ++i) {
+    current->left_ = new Node<int>{i};
+    current->left_->parent_ = current;
+    current = current->left_;
+  }
+  BinaryTree<int> tree{root};
+
+  ASSERT_EQ(depth - 1, tree.InOrder().begin()->value_);
+}
+
+TEST(IteratorPatternTest, PooledTreeIsReleasedInBulk) {
+  static int alive{0};
+  struct Counted {
+    int value_;
+    Counted(int value) : value_(value) { ++alive; }
+    Counted(const Counted& other) : value_(other.value_) { ++alive; }
+    ~Counted() { --alive; }
+  };
+
+  {
+    NodePool<Counted> pool{3};
+    auto leaf = [&pool](int value) { return pool.Create(Counted{value}); };
+    auto root = pool.Create(Counted{1}, pool.Create(Counted{2}, leaf(4), leaf(5)), leaf(3));
+    ASSERT_EQ(5u, pool.size());
+
+    BinaryTree<Counted> tree{root, std::move(pool)};
+    ASSERT_EQ(0u, pool.size());
+    ASSERT_EQ(5u, tree.pool_.size());
+    ASSERT_EQ(5, alive);
+
+    std::vector<int> values;
+    for (auto& node : tree.PostOrder()) values.push_back(node.value_.value_);
+    ASSERT_EQ((std::vector<int>{4, 5, 2, 3, 1}), values);
+  }
+  ASSERT_EQ(0, alive);
 }
 
 }  // namespace
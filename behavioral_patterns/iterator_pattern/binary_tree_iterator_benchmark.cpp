@@ -0,0 +1,73 @@
+/**
+ * Parent-link iterators of BinaryTree against collecting the nodes first, the way
+ * iterator_pattern_exercise's preorder_traversal fills a std::vector (and a std::queue for breadth-first order).
+ */
+#include <cstddef>
+#include <queue>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "binary_tree.hpp"
+#include "complete_tree.hpp"
+
+namespace {
+
+using namespace behavioral::iterator_pattern;
+
+void MaterialisePreOrder(Node<int>* current, std::vector<Node<int>*>& result) {
+  result.push_back(current);
+  if (current->left_) MaterialisePreOrder(current->left_, result);
+  if (current->right_) MaterialisePreOrder(current->right_, result);
+}
+
+template <typename Traversal>
+void BM_Iterator(benchmark::State& state) {
+  BinaryTree<int> tree{BuildCompleteTree<int>(0, static_cast<size_t>(state.range(0)))};
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto& node : typename BinaryTree<int>::template Range<Traversal>{tree.root_}) sum += node.value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_MaterialisedPreOrder(benchmark::State& state) {
+  BinaryTree<int> tree{BuildCompleteTree<int>(0, static_cast<size_t>(state.range(0)))};
+  for (auto _ : state) {
+    std::vector<Node<int>*> nodes;
+    MaterialisePreOrder(tree.root_, nodes);
+    long long sum{0};
+    for (auto node : nodes) sum += node->value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_QueueLevelOrder(benchmark::State& state) {
+  BinaryTree<int> tree{BuildCompleteTree<int>(0, static_cast<size_t>(state.range(0)))};
+  for (auto _ : state) {
+    long long sum{0};
+    std::queue<Node<int>*> pending;
+    pending.push(tree.root_);
+    while (!pending.empty()) {
+      auto node = pending.front();
+      pending.pop();
+      sum += node->value_;
+      if (node->left_) pending.push(node->left_);
+      if (node->right_) pending.push(node->right_);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+using Tree = BinaryTree<int>;
+
+BENCHMARK_TEMPLATE(BM_Iterator, Tree::PreOrderTraversal)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_MaterialisedPreOrder)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Iterator, Tree::InOrderTraversal)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Iterator, Tree::PostOrderTraversal)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_Iterator, Tree::LevelOrderTraversal)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_QueueLevelOrder)->Range(1 << 10, 1 << 22);
+
+}  // namespace
@@ -0,0 +1,38 @@
+#ifndef BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_COMPLETE_TREE_HPP
+#define BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_COMPLETE_TREE_HPP
+
+#include <cstddef>
+
+#include "binary_tree.hpp"
+
+namespace behavioral {
+namespace iterator_pattern {
+
+/**
+ * Fixtures shared by the tests and benchmarks of this directory.
+ *
+ * Builds the subtree rooted at level-order `slot` of a complete tree with `count` nodes, allocating nodes depth
+ * first with create(slot), which returns a Node<T>*. Parent links are filled in.
+ */
+template <typename T, typename Create>
+Node<T>* BuildCompleteTree(size_t slot, size_t count, Create& create) {
+  if (slot >= count) return nullptr;
+  Node<T>* node = create(slot);
+  node->left_ = BuildCompleteTree<T>(2 * slot + 1, count, create);
+  node->right_ = BuildCompleteTree<T>(2 * slot + 2, count, create);
+  if (node->left_) node->left_->parent_ = node;
+  if (node->right_) node->right_->parent_ = node;
+  return node;
+}
+
+// Same with heap allocated nodes whose values are their slots, i.e. 0..count-1 in level order.
+template <typename T>
+Node<T>* BuildCompleteTree(size_t slot, size_t count) {
+  auto create = [](size_t value) { return new Node<T>{static_cast<T>(value)}; };
+  return BuildCompleteTree<T>(slot, count, create);
+}
+
+}  // namespace iterator_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_COMPLETE_TREE_HPP
@@ -0,0 +1,51 @@
+#ifndef BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_COROUTINE_TRAVERSAL_HPP
+#define BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_COROUTINE_TRAVERSAL_HPP
+
+#include "binary_tree.hpp"
+#include "generator.hpp"
+
+namespace behavioral {
+namespace iterator_pattern {
+
+// Lazy depth-first traversals written as plain recursion; see Generator for why recursion is O(1) per element.
+
+template <typename T>
+Generator<Node<T>*> PreOrder(Node<T>* node) {
+  co_yield node;
+  if (node->left_) co_yield ElementsOf{PreOrder(node->left_)};
+  if (node->right_) co_yield ElementsOf{PreOrder(node->right_)};
+}
+
+template <typename T>
+Generator<Node<T>*> InOrder(Node<T>* node) {
+  if (node->left_) co_yield ElementsOf{InOrder(node->left_)};
+  co_yield node;
+  if (node->right_) co_yield ElementsOf{InOrder(node->right_)};
+}
+
+template <typename T>
+Generator<Node<T>*> PostOrder(Node<T>* node) {
+  if (node->left_) co_yield ElementsOf{PostOrder(node->left_)};
+  if (node->right_) co_yield ElementsOf{PostOrder(node->right_)};
+  co_yield node;
+}
+
+template <typename T>
+Generator<Node<T>*> PreOrder(BinaryTree<T>& tree) {
+  if (tree.root_) co_yield ElementsOf{PreOrder(tree.root_)};
+}
+
+template <typename T>
+Generator<Node<T>*> InOrder(BinaryTree<T>& tree) {
+  if (tree.root_) co_yield ElementsOf{InOrder(tree.root_)};
+}
+
+template <typename T>
+Generator<Node<T>*> PostOrder(BinaryTree<T>& tree) {
+  if (tree.root_) co_yield ElementsOf{PostOrder(tree.root_)};
+}
+
+}  // namespace iterator_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_COROUTINE_TRAVERSAL_HPP
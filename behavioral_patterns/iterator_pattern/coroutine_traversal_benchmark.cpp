@@ -0,0 +1,119 @@
+/**
+ * Cost per element of the coroutine traversals against BinaryTree's hand written successor iterator,
+ * and of recursive-yield elision (ElementsOf) against re-yielding every element through each enclosing generator.
+ * The "vine" trees are degenerate (one child per level), where re-yielding degrades to O(depth) per element.
+ */
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+#include "complete_tree.hpp"
+#include "coroutine_traversal.hpp"
+
+namespace {
+
+using namespace behavioral::iterator_pattern;
+
+// Tree of `count` nodes hanging off each other's left child.
+struct Vine {
+  Node<int>* root_{nullptr};
+
+  explicit Vine(size_t count) {
+    Node<int>* last{nullptr};
+    for (size_t i = 0; i < count; ++i) {
+      auto node = new Node<int>{static_cast<int>(i)};
+      if (last) {
+        last->left_ = node;
+        node->parent_ = last;
+      } else {
+        root_ = node;
+      }
+      last = node;
+    }
+  }
+
+  ~Vine() {
+    while (root_) {
+      auto next = root_->left_;
+      root_->left_ = nullptr;
+      delete root_;
+      root_ = next;
+    }
+  }
+};
+
+Generator<Node<int>*> NestedPostOrder(Node<int>* node) {
+  if (node->left_)
+    for (auto x : NestedPostOrder(node->left_)) co_yield x;
+  if (node->right_)
+    for (auto y : NestedPostOrder(node->right_)) co_yield y;
+  co_yield node;
+}
+
+void BM_ManualInOrderIterator(benchmark::State& state) {
+  BinaryTree<int> tree{BuildCompleteTree<int>(0, static_cast<size_t>(state.range(0)))};
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto& node : tree.InOrder()) sum += node.value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CoroutineInOrder(benchmark::State& state) {
+  BinaryTree<int> tree{BuildCompleteTree<int>(0, static_cast<size_t>(state.range(0)))};
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto node : InOrder(tree)) sum += node->value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CoroutinePostOrder(benchmark::State& state) {
+  BinaryTree<int> tree{BuildCompleteTree<int>(0, static_cast<size_t>(state.range(0)))};
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto node : PostOrder(tree)) sum += node->value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_NestedPostOrder(benchmark::State& state) {
+  BinaryTree<int> tree{BuildCompleteTree<int>(0, static_cast<size_t>(state.range(0)))};
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto node : NestedPostOrder(tree.root_)) sum += node->value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CoroutinePostOrderVine(benchmark::State& state) {
+  Vine vine{static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto node : PostOrder(vine.root_)) sum += node->value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_NestedPostOrderVine(benchmark::State& state) {
+  Vine vine{static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto node : NestedPostOrder(vine.root_)) sum += node->value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BM_ManualInOrderIterator)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_CoroutineInOrder)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_CoroutinePostOrder)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_NestedPostOrder)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_CoroutinePostOrderVine)->Range(1 << 8, 1 << 12);
+BENCHMARK(BM_NestedPostOrderVine)->Range(1 << 8, 1 << 12);
+
+}  // namespace
@@ -0,0 +1,189 @@
+#ifndef BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_GENERATOR_HPP
+#define BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_GENERATOR_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace behavioral {
+namespace iterator_pattern {
+
+template <typename T>
+class Generator;
+
+// Wraps a nested generator so that `co_yield ElementsOf{nested}` yields each of its elements in turn.
+template <typename T>
+struct ElementsOf {
+  // Takes the generator by reference and moves from it: aggregate initialisation from the prvalue is miscompiled
+  // by GCC 12 inside coroutines, which then destroys a bitwise copy of the nested frame.
+  explicit ElementsOf(Generator<T>&& generator) : generator_(std::move(generator)) {}
+
+  Generator<T> generator_;
+};
+
+/**
+ * Lazy sequence produced by a C++20 coroutine, e.g.
+ *
+ *   Generator<int> Count(int n) { for (int i = 0; i < n; ++i) co_yield i; }
+ *
+ * Recursive generators are cheap: `co_yield ElementsOf{child}` does not re-yield the child's elements through
+ * every enclosing frame. Instead the outermost (root) coroutine keeps track of the innermost active one (the leaf)
+ * and the consumer resumes the leaf directly. Starting a child or finishing one only suspends the current frame;
+ * the consumer's loop in Advance() then resumes the child or the parent, so every element costs O(1) and the stack
+ * stays flat however deep the nesting, at any optimisation level. Destroying an unfinished generator likewise frees
+ * its chain of nested frames one by one instead of recursively.
+ */
+template <typename T>
+class Generator {
+ public:
+  struct promise_type;
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  // Holds plain handles; the nested generator itself is owned by the parent's promise.
+  struct NestedAwaiter {
+    handle_type nested_;
+    promise_type* parent_{nullptr};
+
+    bool await_ready() noexcept { return !nested_; }
+    void await_suspend(handle_type handle) noexcept {
+      parent_ = &handle.promise();
+      auto& child = nested_.promise();
+      child.root_ = parent_->root_;
+      child.parent_ = parent_;
+      parent_->root_->leaf_ = nested_;
+    }
+    // Frees the finished child right away, so a long chain of nested generators is never torn down recursively.
+    void await_resume() {
+      if (!parent_) return;
+      auto exception = nested_.promise().exception_;
+      parent_->nested_ = Generator{};
+      if (exception) std::rethrow_exception(exception);
+    }
+  };
+
+  struct promise_type {
+    const T* value_{nullptr};  // only maintained by the root
+    promise_type* root_{this};
+    promise_type* parent_{nullptr};
+    handle_type leaf_;  // only maintained by the root
+    std::exception_ptr exception_;
+    Generator nested_;  // the generator currently being yielded from, if any
+
+    Generator get_return_object() noexcept { return Generator{handle_type::from_promise(*this)}; }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+
+    // A yielded temporary lives until the coroutine is resumed, so keeping its address is safe.
+    std::suspend_always yield_value(const T& value) noexcept {
+      root_->value_ = std::addressof(value);
+      return {};
+    }
+    NestedAwaiter yield_value(ElementsOf<T>&& nested) noexcept {
+      nested_ = std::move(nested.generator_);
+      return NestedAwaiter{nested_.handle_};
+    }
+
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+    template <typename U>
+    std::suspend_never await_transform(U&&) = delete;  // generators only yield, they never await
+  };
+
+  struct sentinel {};
+
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    iterator() = default;
+    explicit iterator(handle_type root) : root_(root) {}
+
+    reference operator*() const { return *root_.promise().value_; }
+    pointer operator->() const { return root_.promise().value_; }
+
+    iterator& operator++() {
+      Advance(root_);
+      return *this;
+    }
+    void operator++(int) { ++*this; }
+
+    bool operator==(sentinel) const { return !root_ || root_.done(); }
+    bool operator!=(sentinel other) const { return !(*this == other); }
+
+   private:
+    handle_type root_;
+  };
+
+  Generator() = default;
+  Generator(Generator&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+  Generator& operator=(Generator&& other) noexcept {
+    if (this != &other) {
+      Destroy(handle_);
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  Generator(const Generator&) = delete;
+  Generator& operator=(const Generator&) = delete;
+  ~Generator() { Destroy(handle_); }
+
+  // A generator can only be iterated once.
+  iterator begin() {
+    if (!handle_) return iterator{};
+    handle_.promise().leaf_ = handle_;
+    Advance(handle_);
+    return iterator{handle_};
+  }
+  sentinel end() { return {}; }
+
+ private:
+  explicit Generator(handle_type handle) : handle_(handle) {}
+
+  // Resumes the leaf until one of the frames yields a value or the root finishes. A leaf that suspends after
+  // starting a child has made the child the new leaf; one that finished hands the turn back to its parent, whose
+  // NestedAwaiter frees it.
+  static void Advance(handle_type root) {
+    auto& promise = root.promise();
+    for (;;) {
+      auto leaf = promise.leaf_;
+      leaf.resume();
+      if (leaf.done()) {
+        if (leaf == root) break;
+        promise.leaf_ = handle_type::from_promise(*leaf.promise().parent_);
+      } else if (promise.leaf_ == leaf) {
+        return;  // yielded a value
+      }
+    }
+    if (promise.exception_) std::rethrow_exception(promise.exception_);
+  }
+
+  // Frees `handle` and the chain of generators nested below it, innermost first. Letting each frame's nested_
+  // member destroy the next one would recurse once per nesting level.
+  static void Destroy(handle_type handle) {
+    if (!handle) return;
+    auto frame = handle;
+    while (frame.promise().nested_.handle_) frame = frame.promise().nested_.handle_;
+    while (frame != handle) {
+      auto& parent = *frame.promise().parent_;
+      parent.nested_.handle_ = nullptr;
+      frame.destroy();
+      frame = handle_type::from_promise(parent);
+    }
+    handle.destroy();
+  }
+
+  handle_type handle_;
+};
+
+}  // namespace iterator_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_GENERATOR_HPP
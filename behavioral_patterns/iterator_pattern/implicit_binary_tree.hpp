@@ -0,0 +1,203 @@
+#ifndef BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_IMPLICIT_BINARY_TREE_HPP
+#define BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_IMPLICIT_BINARY_TREE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "binary_tree.hpp"
+
+namespace behavioral {
+namespace iterator_pattern {
+
+/**
+ * Binary tree stored in a single array using the Eytzinger (heap) layout:
+ * the root lives in slot 0 and the children of slot i in slots 2i+1 and 2i+2.
+ *
+ *          0
+ *        /   \
+ *       1     2
+ *      / \   / \
+ *     3   4 5   6
+ *
+ * There are no per-node pointers, parents and children are found with index arithmetic, so every traversal order
+ * is a stackless iterator holding just a slot index. Slots that hold no node are marked in a presence mask;
+ * complete trees (all levels full except the last, filled from the left) leave no holes at all.
+ */
+template <typename T>
+class ImplicitBinaryTree {
+ public:
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  static size_t Left(size_t slot) { return 2 * slot + 1; }
+  static size_t Right(size_t slot) { return 2 * slot + 2; }
+  static size_t Parent(size_t slot) { return (slot - 1) / 2; }
+
+  ImplicitBinaryTree() = default;
+
+  // `level_order` holds the nodes of a complete tree, level by level.
+  explicit ImplicitBinaryTree(std::vector<T> level_order)
+      : slots_(std::move(level_order)), present_(slots_.size(), true), size_(slots_.size()) {}
+
+  // Copies shape and values of a pointer based tree. Sparse or degenerate trees need up to 2^depth slots, so
+  // std::length_error is thrown, before anything is allocated, when more than `max_slots` would be required.
+  static ImplicitBinaryTree FromTree(const Node<T>* root, size_t max_slots = size_t{1} << 24) {
+    ImplicitBinaryTree tree;
+    if (!root) return tree;
+
+    // First pass: find the highest slot. Children are only computed for slots below max_slots, so 2i+2 cannot
+    // overflow however deep the tree is.
+    std::vector<std::pair<const Node<T>*, size_t>> pending{{root, 0}};
+    size_t last{0};
+    while (!pending.empty()) {
+      auto [node, slot] = pending.back();
+      pending.pop_back();
+      if (slot >= max_slots) throw std::length_error("Tree is too sparse for an implicit layout");
+      last = std::max(last, slot);
+      if (node->left_) pending.emplace_back(node->left_, Left(slot));
+      if (node->right_) pending.emplace_back(node->right_, Right(slot));
+    }
+
+    tree.slots_.resize(last + 1);
+    tree.present_.resize(last + 1, false);
+    pending.emplace_back(root, 0);
+    while (!pending.empty()) {
+      auto [node, slot] = pending.back();
+      pending.pop_back();
+      tree.slots_[slot] = node->value_;
+      tree.present_[slot] = true;
+      ++tree.size_;
+      if (node->left_) pending.emplace_back(node->left_, Left(slot));
+      if (node->right_) pending.emplace_back(node->right_, Right(slot));
+    }
+    return tree;
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  bool Present(size_t slot) const { return slot < present_.size() && present_[slot]; }
+
+  T& operator[](size_t slot) { return slots_[slot]; }
+  const T& operator[](size_t slot) const { return slots_[slot]; }
+
+  // Raw storage in level order, the fastest way to visit every value when the order does not matter.
+  // Holes of a sparse tree show up as default constructed values, check Present() for those.
+  const std::vector<T>& Slots() const { return slots_; }
+
+  // Successor functions of the three depth-first orders; each returns npos past the last node.
+  struct InOrderTraversal {
+    static size_t First(const ImplicitBinaryTree& tree) { return tree.Leftmost(0); }
+    static size_t Next(const ImplicitBinaryTree& tree, size_t slot) {
+      if (tree.Present(Right(slot))) return tree.Leftmost(Right(slot));
+      while (slot != 0 && slot == Right(Parent(slot))) slot = Parent(slot);
+      return slot == 0 ? npos : Parent(slot);
+    }
+  };
+
+  struct PreOrderTraversal {
+    static size_t First(const ImplicitBinaryTree& tree) { return tree.Present(0) ? 0 : npos; }
+    static size_t Next(const ImplicitBinaryTree& tree, size_t slot) {
+      if (tree.Present(Left(slot))) return Left(slot);
+      if (tree.Present(Right(slot))) return Right(slot);
+      for (; slot != 0; slot = Parent(slot)) {
+        auto sibling = Right(Parent(slot));
+        if (slot != sibling && tree.Present(sibling)) return sibling;
+      }
+      return npos;
+    }
+  };
+
+  struct PostOrderTraversal {
+    static size_t First(const ImplicitBinaryTree& tree) { return tree.FirstLeaf(0); }
+    static size_t Next(const ImplicitBinaryTree& tree, size_t slot) {
+      if (slot == 0) return npos;
+      auto parent = Parent(slot);
+      if (slot == Left(parent) && tree.Present(Right(parent))) return tree.FirstLeaf(Right(parent));
+      return parent;
+    }
+  };
+
+  template <typename Traversal>
+  class Iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    Iterator() = default;
+    Iterator(ImplicitBinaryTree* tree, size_t slot) : tree_(tree), slot_(slot) {}
+
+    reference operator*() const { return (*tree_)[slot_]; }
+    pointer operator->() const { return &(*tree_)[slot_]; }
+    size_t Slot() const { return slot_; }
+
+    Iterator& operator++() {
+      slot_ = Traversal::Next(*tree_, slot_);
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+
+    bool operator==(const Iterator& other) const { return slot_ == other.slot_; }
+    bool operator!=(const Iterator& other) const { return slot_ != other.slot_; }
+
+   private:
+    ImplicitBinaryTree* tree_{nullptr};
+    size_t slot_{npos};
+  };
+
+  template <typename Traversal>
+  class Range {
+   public:
+    using iterator = Iterator<Traversal>;
+
+    explicit Range(ImplicitBinaryTree& tree) : tree_(tree) {}
+    iterator begin() const { return iterator{&tree_, Traversal::First(tree_)}; }
+    iterator end() const { return iterator{&tree_, npos}; }
+
+   private:
+    ImplicitBinaryTree& tree_;
+  };
+
+  Range<InOrderTraversal> InOrder() { return Range<InOrderTraversal>{*this}; }
+  Range<PreOrderTraversal> PreOrder() { return Range<PreOrderTraversal>{*this}; }
+  Range<PostOrderTraversal> PostOrder() { return Range<PostOrderTraversal>{*this}; }
+
+ private:
+  size_t Leftmost(size_t slot) const {
+    if (!Present(slot)) return npos;
+    while (Present(Left(slot))) slot = Left(slot);
+    return slot;
+  }
+
+  // First node of the subtree in post-order: keep descending, preferring the left child.
+  size_t FirstLeaf(size_t slot) const {
+    if (!Present(slot)) return npos;
+    while (true) {
+      if (Present(Left(slot)))
+        slot = Left(slot);
+      else if (Present(Right(slot)))
+        slot = Right(slot);
+      else
+        return slot;
+    }
+  }
+
+  std::vector<T> slots_;
+  std::vector<unsigned char> present_;
+  size_t size_{0};
+};
+
+}  // namespace iterator_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_IMPLICIT_BINARY_TREE_HPP
@@ -0,0 +1,78 @@
+/**
+ * Traversal throughput of the pointer based BinaryTree versus ImplicitBinaryTree on complete trees.
+ * Pointer trees carry four pointers per value, so they are only measured up to 16M nodes (~1 GB);
+ * the implicit layout is also measured at 128M nodes.
+ */
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "complete_tree.hpp"
+#include "implicit_binary_tree.hpp"
+
+namespace {
+
+using namespace behavioral::iterator_pattern;
+
+ImplicitBinaryTree<int> BuildImplicitTree(size_t count) {
+  std::vector<int> values(count);
+  std::iota(values.begin(), values.end(), 0);
+  return ImplicitBinaryTree<int>{std::move(values)};
+}
+
+long long SumInOrder(const Node<int>* node) {
+  if (!node) return 0;
+  return SumInOrder(node->left_) + node->value_ + SumInOrder(node->right_);
+}
+
+void BM_PointerTreeRecursiveInOrder(benchmark::State& state) {
+  auto count = static_cast<size_t>(state.range(0));
+  BinaryTree<int> tree{BuildCompleteTree<int>(0, count)};
+  for (auto _ : state) benchmark::DoNotOptimize(SumInOrder(tree.root_));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Traversal>
+void BM_ImplicitTree(benchmark::State& state) {
+  auto tree = BuildImplicitTree(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto value : Traversal{}(tree)) sum += value;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+struct InOrder {
+  auto operator()(ImplicitBinaryTree<int>& tree) const { return tree.InOrder(); }
+};
+struct PreOrder {
+  auto operator()(ImplicitBinaryTree<int>& tree) const { return tree.PreOrder(); }
+};
+struct PostOrder {
+  auto operator()(ImplicitBinaryTree<int>& tree) const { return tree.PostOrder(); }
+};
+struct LevelOrder {
+  const std::vector<int>& operator()(ImplicitBinaryTree<int>& tree) const { return tree.Slots(); }
+};
+
+BENCHMARK(BM_PointerTreeRecursiveInOrder)->RangeMultiplier(4)->Range(1 << 20, 1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ImplicitTree, InOrder)
+    ->RangeMultiplier(8)
+    ->Range(1 << 20, 1 << 27)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ImplicitTree, PreOrder)
+    ->RangeMultiplier(8)
+    ->Range(1 << 20, 1 << 27)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ImplicitTree, PostOrder)
+    ->RangeMultiplier(8)
+    ->Range(1 << 20, 1 << 27)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_ImplicitTree, LevelOrder)
+    ->RangeMultiplier(8)
+    ->Range(1 << 20, 1 << 27)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "implicit_binary_tree.hpp"
+
+namespace {
+
+using namespace behavioral::iterator_pattern;
+
+template <typename Range>
+std::string Join(Range range) {
+  std::string result;
+  for (const auto& value : range) result += value;
+  return result;
+}
+
+TEST(ImplicitBinaryTreeTest, CompleteTreeTraversals) {
+  /**
+   *         a
+   *       /   \
+   *      b     c
+   *     / \   /
+   *    d   e f
+   */
+  ImplicitBinaryTree<std::string> tree{{"a", "b", "c", "d", "e", "f"}};
+
+  ASSERT_EQ(6u, tree.size());
+  ASSERT_EQ("dbeafc", Join(tree.InOrder()));
+  ASSERT_EQ("abdecf", Join(tree.PreOrder()));
+  ASSERT_EQ("debfca", Join(tree.PostOrder()));
+}
+
+TEST(ImplicitBinaryTreeTest, CopiesShapeOfPointerTree) {
+  /**
+   *            Me
+   *           /  \
+   *      Mother   Father
+   *      /   \        \
+   *    m'm   m'f      f'f
+   */
+  auto father = new Node<std::string>{"Father"};
+  father->right_ = new Node<std::string>{"f'f"};
+  father->right_->parent_ = father;
+  BinaryTree<std::string> family{
+      new Node<std::string>{"Me",
+                            new Node<std::string>{"Mother", new Node<std::string>{"m'm"}, new Node<std::string>{"m'f"}},
+                            father}};
+
+  auto tree = ImplicitBinaryTree<std::string>::FromTree(family.root_);
+
+  ASSERT_EQ(6u, tree.size());
+  ASSERT_FALSE(tree.Present(5));
+  ASSERT_EQ("m'mMotherm'fMeFatherf'f", Join(tree.InOrder()));
+  ASSERT_EQ("MeMotherm'mm'fFatherf'f", Join(tree.PreOrder()));
+  ASSERT_EQ("m'mm'fMotherf'fFatherMe", Join(tree.PostOrder()));
+}
+
+TEST(ImplicitBinaryTreeTest, DegenerateTreeIsRejected) {
+  auto root = new Node<int>{0};
+  auto current = root;
+  for (int i = 1; i < 64; ++i) {
+    current->right_ = new Node<int>{i};
+    current->right_->parent_ = current;
+    current = current->right_;
+  }
+  BinaryTree<int> chain{root};
+
+  ASSERT_THROW(ImplicitBinaryTree<int>::FromTree(chain.root_, 1 << 20), std::length_error);
+  ASSERT_THROW(ImplicitBinaryTree<int>::FromTree(chain.root_), std::length_error);
+}
+
+TEST(ImplicitBinaryTreeTest, WorksWithStandardAlgorithms) {
+  std::vector<int> values(1000);
+  std::iota(values.begin(), values.end(), 1);
+  ImplicitBinaryTree<int> tree{values};
+
+  auto in_order = tree.InOrder();
+  ASSERT_EQ(500500, std::accumulate(in_order.begin(), in_order.end(), 0));
+  ASSERT_EQ(1000, std::distance(in_order.begin(), in_order.end()));
+
+  auto post_order = tree.PostOrder();
+  ASSERT_EQ(1, *std::find_if(post_order.begin(), post_order.end(), [](int v) { return v == 1; }));
+  ASSERT_TRUE(ImplicitBinaryTree<int>{}.InOrder().begin() == ImplicitBinaryTree<int>{}.InOrder().end());
+}
+
+}  // namespace
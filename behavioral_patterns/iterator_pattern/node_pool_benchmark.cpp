@@ -0,0 +1,85 @@
+/**
+ * Builds and destroys complete trees of 10M nodes, one `new` per node against a NodePool.
+ * Heap trees are torn down by ~Node one `delete` at a time; pooled trees are released block by block.
+ */
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include "benchmark/benchmark.h"
+#include "binary_tree.hpp"
+#include "complete_tree.hpp"
+
+namespace {
+
+using namespace behavioral::iterator_pattern;
+
+template <typename T>
+T MakeValue(size_t slot) {
+  if constexpr (std::is_same_v<T, std::string>)
+    return std::to_string(slot);
+  else
+    return static_cast<T>(slot);
+}
+
+template <typename T>
+void BM_HeapBuildAndDestroy(benchmark::State& state) {
+  auto count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    auto create = [](size_t slot) { return new Node<T>{MakeValue<T>(slot)}; };
+    BinaryTree<T> tree{BuildCompleteTree<T>(0, count, create)};
+    benchmark::DoNotOptimize(tree.root_);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_PooledBuildAndDestroy(benchmark::State& state) {
+  auto count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    NodePool<T> pool;
+    auto create = [&pool](size_t slot) { return pool.Create(MakeValue<T>(slot)); };
+    auto root = BuildCompleteTree<T>(0, count, create);
+    BinaryTree<T> tree{root, std::move(pool)};
+    benchmark::DoNotOptimize(tree.root_);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Destruction alone, the part that used to recurse once per level.
+template <typename T>
+void BM_HeapDestroy(benchmark::State& state) {
+  auto count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto create = [](size_t slot) { return new Node<T>{MakeValue<T>(slot)}; };
+    auto tree = new BinaryTree<T>{BuildCompleteTree<T>(0, count, create)};
+    state.ResumeTiming();
+    delete tree;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename T>
+void BM_PooledDestroy(benchmark::State& state) {
+  auto count = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    NodePool<T> pool;
+    auto create = [&pool](size_t slot) { return pool.Create(MakeValue<T>(slot)); };
+    auto root = BuildCompleteTree<T>(0, count, create);
+    auto tree = new BinaryTree<T>{root, std::move(pool)};
+    state.ResumeTiming();
+    delete tree;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_HeapBuildAndDestroy, int)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PooledBuildAndDestroy, int)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HeapBuildAndDestroy, std::string)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PooledBuildAndDestroy, std::string)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HeapDestroy, int)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_PooledDestroy, int)->Arg(10000000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,223 @@
+#ifndef BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_PARALLEL_TRAVERSAL_HPP
+#define BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_PARALLEL_TRAVERSAL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "behavioral_patterns/common/joining_threads.hpp"
+#include "binary_tree.hpp"
+
+namespace behavioral {
+namespace iterator_pattern {
+
+inline size_t DefaultThreadCount() { return std::max(1u, std::thread::hardware_concurrency()); }
+
+/**
+ * Visits every node of a tree from several threads, forking on subtrees.
+ *
+ * Each worker walks its current subtree depth first with a private stack. After every `grain` nodes it moves the
+ * subtrees still waiting on that stack, except the next one, into its own deque, from which idle workers steal.
+ * The owner takes work from the back of its deque (the most recently split, smallest subtrees) and thieves from
+ * the front (the subtrees closest to the root, i.e. the largest), so big pieces of work migrate and small ones stay
+ * local. Below the grain size a subtree is never split, which keeps scheduling overhead per node small. Workers that
+ * find nothing to steal sleep until a subtree is shared or the traversal ends. If `visit` throws, the other workers
+ * stop after their current node and Run() rethrows the first exception once every worker has finished.
+ */
+template <typename T>
+class SubtreeScheduler {
+ public:
+  SubtreeScheduler(size_t threads, size_t grain) : grain_(std::max<size_t>(grain, 1)) {
+    for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) workers_.push_back(std::make_unique<Worker>());
+  }
+
+  size_t Threads() const { return workers_.size(); }
+
+  // Makes Run() return as soon as every worker has finished the node it is visiting.
+  void Stop() {
+    stop_ = true;
+    Wake();
+  }
+
+  // Calls visit(worker_index, node) once for every node below `root`; worker_index < Threads().
+  template <typename Visit>
+  void Run(Node<T>* root, Visit&& visit) {
+    if (!root) return;
+    for (auto& worker : workers_) {  // a stopped run leaves its unvisited subtrees behind
+      std::lock_guard<std::mutex> lock{worker->mutex_};
+      worker->tasks_.clear();
+    }
+    stop_ = false;
+    pending_ = 1;
+    queued_ = 1;
+    workers_[0]->tasks_.push_back(root);
+
+    std::vector<std::exception_ptr> errors(workers_.size());
+    auto work = [this, &visit, &errors](size_t self) {
+      try {
+        Work(self, visit);
+      } catch (...) {
+        errors[self] = std::current_exception();
+        Stop();
+      }
+    };
+    {
+      common::JoiningThreads threads{workers_.size() - 1};
+      try {
+        for (size_t i = 1; i < workers_.size(); ++i) threads.Start(work, i);
+      } catch (...) {
+        Stop();  // the root task may never be picked up, so started workers would wait for it forever
+        throw;
+      }
+      work(0);
+    }
+    for (auto& error : errors)
+      if (error) std::rethrow_exception(error);
+  }
+
+ private:
+  struct Worker {
+    std::mutex mutex_;
+    std::deque<Node<T>*> tasks_;
+  };
+
+  template <typename Visit>
+  void Work(size_t self, Visit& visit) {
+    std::vector<Node<T>*> stack;
+    while (pending_ > 0 && !stop_) {
+      Node<T>* task{nullptr};
+      if (!Pop(self, task)) {
+        std::unique_lock<std::mutex> lock{idle_mutex_};
+        idle_.wait(lock, [this]() { return queued_ > 0 || pending_ == 0 || stop_; });
+        continue;
+      }
+
+      stack.push_back(task);
+      size_t visited{0};
+      while (!stack.empty() && !stop_) {
+        auto node = stack.back();
+        stack.pop_back();
+        visit(self, *node);
+        if (node->right_) stack.push_back(node->right_);
+        if (node->left_) stack.push_back(node->left_);
+
+        if (++visited >= grain_ && stack.size() > 1) {
+          Share(self, stack);
+          visited = 0;
+        }
+      }
+      stack.clear();
+      if (--pending_ == 0) Wake();
+    }
+  }
+
+  // Lets sleeping workers recheck their wake-up condition; taking the mutex keeps the notification from arriving
+  // between a worker's check and its wait.
+  void Wake() {
+    { std::lock_guard<std::mutex> lock{idle_mutex_}; }
+    idle_.notify_all();
+  }
+
+  // Publishes all but the top of the stack as stealable tasks.
+  void Share(size_t self, std::vector<Node<T>*>& stack) {
+    auto shared = stack.size() - 1;
+    pending_ += shared;
+    {
+      std::lock_guard<std::mutex> lock{workers_[self]->mutex_};
+      auto& tasks = workers_[self]->tasks_;
+      tasks.insert(tasks.end(), stack.begin(), stack.begin() + static_cast<std::ptrdiff_t>(shared));
+      queued_ += shared;
+    }
+    stack.erase(stack.begin(), stack.begin() + static_cast<std::ptrdiff_t>(shared));
+    Wake();
+  }
+
+  bool Pop(size_t self, Node<T>*& task) {
+    {
+      std::lock_guard<std::mutex> lock{workers_[self]->mutex_};
+      auto& tasks = workers_[self]->tasks_;
+      if (!tasks.empty()) {
+        task = tasks.back();
+        tasks.pop_back();
+        --queued_;
+        return true;
+      }
+    }
+    for (size_t offset = 1; offset < workers_.size(); ++offset) {
+      auto& victim = *workers_[(self + offset) % workers_.size()];
+      std::lock_guard<std::mutex> lock{victim.mutex_};
+      if (!victim.tasks_.empty()) {
+        task = victim.tasks_.front();
+        victim.tasks_.pop_front();
+        --queued_;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  size_t grain_;
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::atomic<size_t> pending_{0};  // tasks queued or running
+  std::atomic<size_t> queued_{0};   // tasks in the deques, updated under the owning worker's mutex
+  std::atomic<bool> stop_{false};
+  std::mutex idle_mutex_;
+  std::condition_variable idle_;
+};
+
+// Calls f(node) for every node, concurrently and in no particular order.
+template <typename T, typename F>
+void ParallelForEach(BinaryTree<T>& tree, F f, size_t threads = DefaultThreadCount(), size_t grain = 4096) {
+  SubtreeScheduler<T> scheduler{threads, grain};
+  scheduler.Run(tree.root_, [&f](size_t, Node<T>& node) { f(node); });
+}
+
+/**
+ * Folds every node into a per-thread accumulator with reduce(accumulator, node), then merges the accumulators
+ * with combine(lhs, rhs). Nodes reach the accumulators in no particular order, so reduce and combine
+ * must be associative and commutative, with `identity` neutral for both.
+ */
+template <typename T, typename R, typename Reduce, typename Combine>
+R ParallelReduce(BinaryTree<T>& tree, R identity, Reduce reduce, Combine combine,
+                 size_t threads = DefaultThreadCount(), size_t grain = 4096) {
+  struct alignas(64) Partial {  // one cache line each, so workers never write to a shared line
+    R value_;
+  };
+
+  SubtreeScheduler<T> scheduler{threads, grain};
+  std::vector<Partial> partials(scheduler.Threads(), Partial{identity});
+  scheduler.Run(tree.root_, [&](size_t worker, Node<T>& node) {
+    partials[worker].value_ = reduce(std::move(partials[worker].value_), node);
+  });
+
+  R result = identity;
+  for (auto& partial : partials) result = combine(std::move(result), std::move(partial.value_));
+  return result;
+}
+
+// Returns some node satisfying `predicate` (not necessarily the first in any order), or nullptr.
+template <typename T, typename Predicate>
+Node<T>* ParallelFind(BinaryTree<T>& tree, Predicate predicate, size_t threads = DefaultThreadCount(),
+                      size_t grain = 4096) {
+  SubtreeScheduler<T> scheduler{threads, grain};
+  std::atomic<Node<T>*> found{nullptr};
+  scheduler.Run(tree.root_, [&](size_t, Node<T>& node) {
+    if (!predicate(node)) return;
+    Node<T>* expected{nullptr};
+    if (found.compare_exchange_strong(expected, &node)) scheduler.Stop();
+  });
+  return found;
+}
+
+}  // namespace iterator_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_ITERATOR_PATTERN_PARALLEL_TRAVERSAL_HPP
@@ -0,0 +1,78 @@
+/**
+ * Parallel subtree reduction against a sequential walk, summing the values of a complete tree.
+ * Run with increasing thread counts to read off the speedup; every run uses real time, as the work is spread across
+ * threads. Trees with up to 16M nodes take a few seconds to build.
+ */
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+#include "complete_tree.hpp"
+#include "parallel_traversal.hpp"
+
+namespace {
+
+using namespace behavioral::iterator_pattern;
+
+BinaryTree<long long>& SharedTree(size_t count) {
+  static size_t built{0};
+  static BinaryTree<long long>* tree{nullptr};
+  if (built != count) {
+    delete tree;
+    tree = new BinaryTree<long long>{BuildCompleteTree<long long>(0, count)};
+    built = count;
+  }
+  return *tree;
+}
+
+void BM_SequentialSum(benchmark::State& state) {
+  auto& tree = SharedTree(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    long long sum{0};
+    for (auto& node : tree.PreOrder()) sum += node.value_;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ParallelSum(benchmark::State& state) {
+  auto& tree = SharedTree(static_cast<size_t>(state.range(0)));
+  auto threads = static_cast<size_t>(state.range(1));
+  for (auto _ : state) {
+    auto sum = ParallelReduce(
+        tree, 0LL, [](long long partial, const Node<long long>& node) { return partial + node.value_; },
+        [](long long lhs, long long rhs) { return lhs + rhs; }, threads, static_cast<size_t>(state.range(2)));
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ParallelCount(benchmark::State& state) {
+  auto& tree = SharedTree(static_cast<size_t>(state.range(0)));
+  auto threads = static_cast<size_t>(state.range(1));
+  for (auto _ : state) {
+    auto even = ParallelReduce(
+        tree, size_t{0}, [](size_t partial, const Node<long long>& node) { return partial + (node.value_ % 2 == 0); },
+        [](size_t lhs, size_t rhs) { return lhs + rhs; }, threads);
+    benchmark::DoNotOptimize(even);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_SequentialSum)->Arg(1 << 20)->Arg(1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelSum)
+    ->ArgsProduct({{1 << 20, 1 << 24}, {1, 2, 4, 8, 16}, {4096}})
+    ->ArgNames({"nodes", "threads", "grain"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelSum)
+    ->ArgsProduct({{1 << 24}, {8}, {64, 1024, 65536}})
+    ->ArgNames({"nodes", "threads", "grain"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ParallelCount)
+    ->ArgsProduct({{1 << 24}, {1, 8}})
+    ->ArgNames({"nodes", "threads"})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
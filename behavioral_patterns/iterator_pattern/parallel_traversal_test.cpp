@@ -0,0 +1,112 @@
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "complete_tree.hpp"
+#include "gtest/gtest.h"
+#include "parallel_traversal.hpp"
+
+namespace {
+
+using namespace behavioral::iterator_pattern;
+
+// Left spine with a right leaf hanging off every other node, so most subtrees are tiny.
+Node<long long>* BuildLopsidedTree(size_t count) {
+  Node<long long>* root{nullptr};
+  for (size_t i = count; i-- > 0;) {
+    auto node = new Node<long long>{static_cast<long long>(2 * i)};
+    node->left_ = root;
+    if (i % 2 == 0) node->right_ = new Node<long long>{static_cast<long long>(2 * i + 1)};
+    root = node;
+  }
+  return root;
+}
+
+long long Sum(BinaryTree<long long>& tree, size_t threads, size_t grain) {
+  return ParallelReduce(
+      tree, 0LL, [](long long sum, const Node<long long>& node) { return sum + node.value_; },
+      [](long long lhs, long long rhs) { return lhs + rhs; }, threads, grain);
+}
+
+TEST(ParallelTraversalTest, ReduceMatchesSequentialSum) {
+  const size_t count{100000};
+  BinaryTree<long long> tree{BuildCompleteTree<long long>(0, count)};
+  const auto expected = static_cast<long long>(count * (count - 1) / 2);
+
+  for (size_t threads : {size_t{1}, size_t{2}, size_t{4}, size_t{8}})
+    for (size_t grain : {size_t{1}, size_t{64}, size_t{4096}, size_t{1} << 20})
+      ASSERT_EQ(expected, Sum(tree, threads, grain));
+
+  BinaryTree<long long> empty{nullptr};
+  ASSERT_EQ(0, Sum(empty, 4, 16));
+}
+
+TEST(ParallelTraversalTest, ForEachVisitsEveryNodeExactlyOnce) {
+  BinaryTree<long long> tree{BuildLopsidedTree(2000)};
+  std::vector<std::atomic<int>> visits(4000);
+
+  ParallelForEach(
+      tree, [&visits](Node<long long>& node) { ++visits[static_cast<size_t>(node.value_)]; }, 4, 8);
+  for (size_t i = 0; i < visits.size(); ++i) ASSERT_EQ(i % 4 == 3 ? 0 : 1, visits[i]) << i;
+
+  // Nodes are handed out mutable, each to a single thread.
+  auto sum = Sum(tree, 1, 1);
+  ParallelForEach(tree, [](Node<long long>& node) { node.value_ = -node.value_; }, 4, 8);
+  ASSERT_EQ(-sum, Sum(tree, 3, 16));
+}
+
+TEST(ParallelTraversalTest, FindStopsAtAMatch) {
+  BinaryTree<long long> tree{BuildCompleteTree<long long>(0, 50000)};
+
+  auto found = ParallelFind(tree, [](const Node<long long>& node) { return node.value_ == 31337; }, 4, 32);
+  ASSERT_NE(nullptr, found);
+  ASSERT_EQ(31337, found->value_);
+
+  auto any_odd = ParallelFind(tree, [](const Node<long long>& node) { return node.value_ % 2 == 1; }, 4, 32);
+  ASSERT_NE(nullptr, any_odd);
+  ASSERT_EQ(1, any_odd->value_ % 2);
+
+  ASSERT_EQ(nullptr, ParallelFind(tree, [](const Node<long long>& node) { return node.value_ < 0; }, 4, 32));
+}
+
+TEST(ParallelTraversalTest, SchedulerCanRunAgainAfterStop) {
+  const size_t count{50000};
+  BinaryTree<long long> tree{BuildCompleteTree<long long>(0, count)};
+  SubtreeScheduler<long long> scheduler{4, 16};
+
+  for (int round = 0; round < 10; ++round) {
+    scheduler.Run(tree.root_, [&scheduler](size_t, Node<long long>& node) {
+      if (node.value_ == 1000) scheduler.Stop();
+    });
+
+    // Subtrees left queued by the stopped run must not be visited again.
+    std::atomic<size_t> visited{0};
+    scheduler.Run(tree.root_, [&visited](size_t, Node<long long>&) { ++visited; });
+    ASSERT_EQ(count, visited) << round;
+  }
+}
+
+TEST(ParallelTraversalTest, VisitorExceptionIsRethrownAfterWorkersStop) {
+  const size_t count{50000};
+  BinaryTree<long long> tree{BuildCompleteTree<long long>(0, count)};
+  SubtreeScheduler<long long> scheduler{4, 16};
+
+  for (long long bad : {0LL, 1000LL, 49999LL}) {
+    auto visit = [bad](size_t, Node<long long>& node) {
+      if (node.value_ == bad) throw std::runtime_error{"bad node"};
+    };
+    ASSERT_THROW(scheduler.Run(tree.root_, visit), std::runtime_error) << bad;
+
+    std::atomic<size_t> visited{0};
+    scheduler.Run(tree.root_, [&visited](size_t, Node<long long>&) { ++visited; });
+    ASSERT_EQ(count, visited) << bad;
+  }
+
+  auto throwing = [](Node<long long>& node) {
+    if (node.value_ == 777) throw std::runtime_error{"bad node"};
+  };
+  ASSERT_THROW(ParallelForEach(tree, throwing, 4, 8), std::runtime_error);
+}
+
+}  // namespace
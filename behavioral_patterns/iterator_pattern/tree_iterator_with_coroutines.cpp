@@ -1,119 +1,9 @@
-#include <experimental/coroutine>
-#include <experimental/generator>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
-namespace behavioral {
-namespace iterator_pattern {
-
-/**
- *        A
- *      /   \
- *     B     C
- */
-template <typename T>
-struct BinaryTree;
-
-template <typename T>
-struct Node {
-  T value_ = T();
-  Node<T>*left_{nullptr}, *right_{nullptr}, *parent_{nullptr};
-  BinaryTree<T>* tree_{nullptr};
-
-  Node(T value) : value_(value) {}
-
-  Node(T value, Node<T>* left, Node<T>* right) : value_(value), left_(left), right_(right) {
-    this->right_->tree_ = this->left_->tree_ = tree_;
-    this->right_->parent_ = this->left_->parent_ = this;
-  }
-
-  void SetTree(BinaryTree<T>* t) {
-    tree_ = t;
-    if (left_) left_->SetTree(t);
-    if (right_) right_->SetTree(t);
-  }
-
-  ~Node() {
-    if (left_) delete left_;
-    if (right_) delete right_;
-  }
-};
-
-template <typename T>
-struct BinaryTree {
-  Node<T>* root_{nullptr};
-
-  BinaryTree(Node<T>* root) : root_(root) { root->SetTree(this); }
-
-  ~BinaryTree() {
-    if (root_) delete root_;
-  }
-
-  // Iterator for Binary Tree
-  template <typename U>
-  struct PreOrderIterator {
-    Node<U>* current_;
-    PreOrderIterator(Node<U>* current) : current_(current) {}
-
-    bool operator!=(const PreOrderIterator<U>& other) { return current_ != other.current_; }
-
-    PreOrderIterator<U>& operator++() {
-      if (current_->right_) {
-        current_ = current_->right_;
-        while (current_->left_) {
-          current_ = current_->left_;
-        }
-      } else {
-        Node<T>* p = current_->parent_;
-        while (p && current_ == p->right_) {
-          current_ = p;
-          p = p->parent_;
-        }
-        current_ = p;
-      }
-      return *this;
-    }
-
-    Node<U>& operator*() { return *current_; }
-  };  // PreOrderIterator
-
-  typedef PreOrderIterator<T> iterator;
-  iterator begin() {
-    Node<T>* n = root_;
-    if (n) {
-      while (n->left_) {
-        n = n->left_;
-      }
-    }
-    return iterator{nullptr};
-  }
-
-  iterator end() { return iterator{nullptr}; }
-
-  // RECURSE TRAVERSAL
-  class PreOrderTraversal {
-    BinaryTree& tree_;
-
-   public:
-    PreOrderTraversal(BinaryTree& tree) : tree_(tree) {}
-    iterator begin() { return tree_.begin(); }
-    iterator end() { return tree_.end(); }
-  } pre_order;
-
-  experimental::generator<Node<T>*> PostOrder() { return PostOrderImpl(root_); }
-
- private:
-  experimental::generator<Node<T>*> PostOrderImpl(Node<T>* node) {
-    if (node) {
-      for (auto x : PostOrderImpl(node->left_)) co_yield x;
-      for (auto y : PostOrderImpl(node->right_)) co_yield y;
-      co_yield node;
-    }
-  }
-};
-
-}  // namespace iterator_pattern
-}  // namespace behavioral
+#include "coroutine_traversal.hpp"
 
 // TEST---------------------------------------------------------------------------------------------------------------|
 
@@ -137,13 +27,60 @@ TEST(IteratorPatternTest, IteratorsInTheStandardTemplateLibrary) {
                                                   new Node<std::string>{"Mother's father"}},
                             new Node<std::string>{"Father"}}};
 
-  for (const auto& it : family.pre_order) {
-    // ...
+  std::vector<std::string> names;
+  for (auto node : PostOrder(family)) {
+    std::cout << node->value_ << std::endl;
+    names.push_back(node->value_);
+  }
+  ASSERT_EQ((std::vector<std::string>{"Mother's mother", "Mother's father", "Mother", "Father", "Me"}), names);
+
+  names.clear();
+  for (auto node : PreOrder(family)) names.push_back(node->value_);
+  ASSERT_EQ((std::vector<std::string>{"Me", "Mother", "Mother's mother", "Mother's father", "Father"}), names);
+
+  names.clear();
+  for (auto node : InOrder(family)) names.push_back(node->value_);
+  ASSERT_EQ((std::vector<std::string>{"Mother's mother", "Mother", "Mother's father", "Me", "Father"}), names);
+}
+
+TEST(IteratorPatternTest, DegenerateTreeIsTraversedInOrder) {
+  // One left child per level: re-yielding through every enclosing generator would make this quadratic, and
+  // resuming or destroying the nested generators recursively would need one stack frame per level.
+  auto root = new Node<int>{0};
+  auto current = root;
+  for (int i = 1; i < 10000; ++i) {
+    current->left_ = new Node<int>{i};
+    current->left_->parent_ = current;
+    current = current->left_;
   }
 
-  for (const auto& it : family.PostOrder()) {
-    std::cout << it->value_ << std::endl;
+  int expected{9999};
+  for (auto node : PostOrder(root)) ASSERT_EQ(expected--, node->value_);
+  ASSERT_EQ(-1, expected);
+
+  // Stopping deep inside the chain leaves ~9000 nested generators for the root's destructor to free.
+  expected = 0;
+  for (auto node : PreOrder(root)) {
+    ASSERT_EQ(expected++, node->value_);
+    if (expected == 9000) break;
   }
+
+  delete root;  // ~Node frees its subtree without recursing, however deep the chain
+}
+
+Generator<int> Throwing(int depth) {
+  if (depth == 0) throw std::runtime_error("leaf failed");
+  co_yield depth;
+  co_yield ElementsOf{Throwing(depth - 1)};
+}
+
+TEST(IteratorPatternTest, ExceptionsPropagateThroughNestedGenerators) {
+  std::vector<int> seen;
+  auto collect = [&seen]() {
+    for (auto value : Throwing(3)) seen.push_back(value);
+  };
+  ASSERT_THROW(collect(), std::runtime_error);
+  ASSERT_EQ((std::vector<int>{3, 2, 1}), seen);
 }
 
 }  // namespace
@@ -0,0 +1,113 @@
+#ifndef BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_COW_BUFFER_HPP
+#define BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_COW_BUFFER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace behavioral {
+namespace memento_pattern {
+
+/**
+ * Fixed-size byte buffer for large originator state with O(1) snapshots.
+ *
+ * Bytes live in 4 KB pages, reached through a two-level page table (a directory of chunks of 256 pages), and every
+ * level is reference counted. Copying a buffer, which is how a memento is taken, copies only the directory pointer.
+ * The first write to a page afterwards duplicates that page, plus the chunk and directory pointing to it if they
+ * are still shared, so each snapshot costs memory only for the pages changed after it. Pages never written read as
+ * zeros and take no memory at all.
+ *
+ * Copies may be read concurrently, but a buffer must not be written while it is being copied on another thread.
+ */
+class CowBuffer {
+ public:
+  static constexpr size_t kPageSize = 4096;
+  static constexpr size_t kPagesPerChunk = 256;
+
+  CowBuffer() = default;
+  explicit CowBuffer(size_t size) : size_(size), directory_(std::make_shared<Directory>()) {
+    auto chunks = (PageCount() + kPagesPerChunk - 1) / kPagesPerChunk;
+    for (size_t i = 0; i < chunks; ++i) directory_->push_back(std::make_shared<Chunk>());
+  }
+
+  size_t size() const { return size_; }
+  size_t PageCount() const { return (size_ + kPageSize - 1) / kPageSize; }
+
+  void Read(size_t offset, void* out, size_t count) const {
+    Check(offset, count);
+    auto destination = static_cast<char*>(out);
+    while (count > 0) {
+      auto in_page = offset % kPageSize;
+      auto n = std::min(count, kPageSize - in_page);
+      std::memcpy(destination, Page(offset / kPageSize) + in_page, n);
+      destination += n;
+      offset += n;
+      count -= n;
+    }
+  }
+
+  void Write(size_t offset, const void* data, size_t count) {
+    Check(offset, count);
+    auto source = static_cast<const char*>(data);
+    while (count > 0) {
+      auto in_page = offset % kPageSize;
+      auto n = std::min(count, kPageSize - in_page);
+      std::memcpy(MutablePage(offset / kPageSize) + in_page, source, n);
+      source += n;
+      offset += n;
+      count -= n;
+    }
+  }
+
+  // Start of a page, for reading it in place.
+  const char* Page(size_t page) const {
+    CheckPage(page);
+    auto& slot = (*(*directory_)[page / kPagesPerChunk])[page % kPagesPerChunk];
+    return slot ? slot->data() : ZeroPage().data();
+  }
+
+  // Start of a page, for writing it in place; duplicates the page first if a snapshot still shares it.
+  char* MutablePage(size_t page) {
+    CheckPage(page);
+    if (directory_.use_count() > 1) directory_ = std::make_shared<Directory>(*directory_);
+    auto& chunk = (*directory_)[page / kPagesPerChunk];
+    if (chunk.use_count() > 1) chunk = std::make_shared<Chunk>(*chunk);
+    auto& slot = (*chunk)[page % kPagesPerChunk];
+    if (!slot)
+      slot = std::make_shared<PageData>();
+    else if (slot.use_count() > 1)
+      slot = std::make_shared<PageData>(*slot);
+    return slot->data();
+  }
+
+ private:
+  using PageData = std::array<char, kPageSize>;
+  using Chunk = std::array<std::shared_ptr<PageData>, kPagesPerChunk>;
+  using Directory = std::vector<std::shared_ptr<Chunk>>;
+
+  static const PageData& ZeroPage() {
+    static const PageData zeros{};
+    return zeros;
+  }
+
+  void Check(size_t offset, size_t count) const {
+    if (offset > size_ || count > size_ - offset) throw std::out_of_range("Access past the end of the buffer");
+  }
+
+  // Also keeps an empty or default constructed buffer, which has no directory, from being dereferenced.
+  void CheckPage(size_t page) const {
+    if (page >= PageCount()) throw std::out_of_range("Page past the end of the buffer");
+  }
+
+  size_t size_{0};
+  std::shared_ptr<Directory> directory_;
+};
+
+}  // namespace memento_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_COW_BUFFER_HPP
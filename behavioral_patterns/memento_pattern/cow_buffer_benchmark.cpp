@@ -0,0 +1,58 @@
+/**
+ * Cost of taking a memento of a fully populated state of 1 MB to 256 MB: copying a CowBuffer against copying
+ * a std::vector<char>, and the price paid afterwards for touching 1% of the pages once.
+ */
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "cow_buffer.hpp"
+
+namespace {
+
+using namespace behavioral::memento_pattern;
+
+CowBuffer FilledBuffer(size_t size) {
+  CowBuffer buffer{size};
+  for (size_t page = 0; page < buffer.PageCount(); ++page) buffer.MutablePage(page)[0] = 1;
+  return buffer;
+}
+
+void BM_CowSnapshot(benchmark::State& state) {
+  auto buffer = FilledBuffer(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    CowBuffer snapshot{buffer};
+    benchmark::DoNotOptimize(snapshot);
+  }
+  state.SetLabel(std::to_string(state.range(0) >> 20) + " MB");
+}
+
+void BM_VectorSnapshot(benchmark::State& state) {
+  std::vector<char> state_bytes(static_cast<size_t>(state.range(0)), 1);
+  for (auto _ : state) {
+    auto snapshot = state_bytes;
+    benchmark::DoNotOptimize(snapshot.data());
+  }
+  state.SetLabel(std::to_string(state.range(0) >> 20) + " MB");
+}
+
+// Snapshot, then write one byte into every hundredth page: the pages duplicated after the snapshot.
+void BM_CowSnapshotThenTouchOnePercent(benchmark::State& state) {
+  auto buffer = FilledBuffer(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    CowBuffer snapshot{buffer};
+    for (size_t page = 0; page < buffer.PageCount(); page += 100) buffer.MutablePage(page)[1] = 2;
+    benchmark::DoNotOptimize(snapshot);
+  }
+  state.SetLabel(std::to_string(state.range(0) >> 20) + " MB");
+}
+
+}  // namespace
+
+BENCHMARK(BM_CowSnapshot)->RangeMultiplier(16)->Range(1 << 20, 1 << 28);
+BENCHMARK(BM_VectorSnapshot)->RangeMultiplier(16)->Range(1 << 20, 1 << 28)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CowSnapshotThenTouchOnePercent)
+    ->RangeMultiplier(16)
+    ->Range(1 << 20, 1 << 28)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,94 @@
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "cow_buffer.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+using namespace behavioral::memento_pattern;
+
+// An originator with megabytes of state; mementos share every page it has not changed since.
+class Canvas {
+ public:
+  class Memento {
+   public:
+    friend class Canvas;
+
+   private:
+    explicit Memento(CowBuffer pixels) : pixels_(std::move(pixels)) {}
+    CowBuffer pixels_;
+  };
+
+  Canvas(size_t width, size_t height) : width_(width), pixels_(width * height) {}
+
+  void Paint(size_t x, size_t y, char color) { pixels_.Write(y * width_ + x, &color, 1); }
+  char At(size_t x, size_t y) const {
+    char color;
+    pixels_.Read(y * width_ + x, &color, 1);
+    return color;
+  }
+
+  Memento Save() const { return Memento{pixels_}; }
+  void Restore(const Memento& m) { pixels_ = m.pixels_; }
+
+  const CowBuffer& Pixels() const { return pixels_; }
+
+ private:
+  size_t width_;
+  CowBuffer pixels_;
+};
+
+TEST(CowBufferTest, MementosOfALargeOriginator) {
+  Canvas canvas{2048, 2048};  // 4 MB, 1024 pages
+  canvas.Paint(0, 0, 'a');
+  auto before = canvas.Save();
+
+  canvas.Paint(0, 0, 'b');
+  canvas.Paint(2047, 2047, 'c');
+  ASSERT_EQ('b', canvas.At(0, 0));
+  auto after = canvas.Save();
+
+  canvas.Restore(before);
+  ASSERT_EQ('a', canvas.At(0, 0));
+  ASSERT_EQ(0, canvas.At(2047, 2047));
+  canvas.Restore(after);
+  ASSERT_EQ('b', canvas.At(0, 0));
+  ASSERT_EQ('c', canvas.At(2047, 2047));
+}
+
+TEST(CowBufferTest, OnlyWrittenPagesAreDuplicated) {
+  CowBuffer buffer{100 * CowBuffer::kPageSize};
+  std::vector<char> page(CowBuffer::kPageSize, 'x');
+  for (size_t i = 0; i < buffer.PageCount(); ++i) buffer.Write(i * CowBuffer::kPageSize, page.data(), page.size());
+
+  auto snapshot = buffer;
+  ASSERT_EQ(snapshot.Page(7), buffer.Page(7));
+
+  const char text[] = "spans two pages";
+  buffer.Write(8 * CowBuffer::kPageSize - 4, text, sizeof(text));
+  for (size_t i = 0; i < buffer.PageCount(); ++i) {
+    if (i == 7 || i == 8)
+      ASSERT_NE(snapshot.Page(i), buffer.Page(i)) << i;
+    else
+      ASSERT_EQ(snapshot.Page(i), buffer.Page(i)) << i;
+  }
+
+  char read[sizeof(text)];
+  buffer.Read(8 * CowBuffer::kPageSize - 4, read, sizeof(read));
+  ASSERT_STREQ(text, read);
+  snapshot.Read(8 * CowBuffer::kPageSize - 4, read, sizeof(read));
+  ASSERT_EQ(std::vector<char>(sizeof(read), 'x'), std::vector<char>(read, read + sizeof(read)));
+
+  ASSERT_THROW(buffer.Read(buffer.size() - 1, read, 2), std::out_of_range);
+  ASSERT_THROW(buffer.Page(buffer.PageCount()), std::out_of_range);
+  ASSERT_THROW(buffer.MutablePage(buffer.PageCount()), std::out_of_range);
+
+  CowBuffer empty;
+  ASSERT_THROW(empty.Page(0), std::out_of_range);
+  ASSERT_THROW(empty.MutablePage(0), std::out_of_range);
+}
+
+}  // namespace
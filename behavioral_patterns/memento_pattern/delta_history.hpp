@@ -0,0 +1,91 @@
+#ifndef BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_DELTA_HISTORY_HPP
+#define BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_DELTA_HISTORY_HPP
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace behavioral {
+namespace memento_pattern {
+
+/**
+ * Bounded undo/redo history that stores the change made by every version instead of the resulting state.
+ *
+ * Version v is reached from version v-1 by `state + delta`, and left again by `state - delta`, so undo and redo are
+ * a single ring buffer access. Only the last `capacity` deltas are kept: older versions fall off the ring and memory
+ * stays fixed however long the history grows. Every `snapshot_interval` versions the full state is stored as well,
+ * which lets At() rebuild any retained version from the nearest snapshot in at most `snapshot_interval` steps.
+ */
+template <typename State, typename Delta = State>
+class DeltaHistory {
+ public:
+  DeltaHistory(State initial, size_t capacity, size_t snapshot_interval = 64)
+      : deltas_(capacity), interval_(snapshot_interval), newest_state_(initial) {
+    if (capacity == 0 || snapshot_interval == 0) throw std::invalid_argument("History must hold at least one version");
+    snapshots_.resize(capacity / snapshot_interval + 1);
+    snapshots_[0] = initial;
+  }
+
+  size_t Current() const { return current_; }
+  size_t Oldest() const { return oldest_; }
+  size_t Newest() const { return newest_; }
+  size_t Capacity() const { return deltas_.size(); }
+
+  // `state` is the state after applying `delta` to the current version. Versions that could be redone are dropped.
+  void Record(const Delta& delta, const State& state) {
+    newest_ = ++current_;
+    deltas_[Slot(current_)] = delta;
+    if (newest_ - oldest_ > deltas_.size()) ++oldest_;
+    if (current_ % interval_ == 0) snapshots_[(current_ / interval_) % snapshots_.size()] = state;
+    newest_state_ = state;
+  }
+
+  // Moves `state` one version back; false once the oldest retained version is reached.
+  bool Undo(State& state) {
+    if (current_ == oldest_) return false;
+    state = state - deltas_[Slot(current_--)];
+    return true;
+  }
+
+  bool Redo(State& state) {
+    if (current_ == newest_) return false;
+    state = state + deltas_[Slot(++current_)];
+    return true;
+  }
+
+  // State of any retained version, without moving the current one.
+  std::optional<State> At(size_t version) const {
+    if (version < oldest_ || version > newest_) return std::nullopt;
+
+    auto floor = version - version % interval_;
+    if (floor >= oldest_) {
+      auto state = Snapshot(floor);
+      for (auto v = floor + 1; v <= version; ++v) state = state + deltas_[Slot(v)];
+      return state;
+    }
+
+    auto ceil = floor + interval_;
+    auto start = ceil <= newest_ ? ceil : newest_;
+    auto state = ceil <= newest_ ? Snapshot(ceil) : newest_state_;
+    for (auto v = start; v > version; --v) state = state - deltas_[Slot(v)];
+    return state;
+  }
+
+ private:
+  size_t Slot(size_t version) const { return version % deltas_.size(); }
+  const State& Snapshot(size_t version) const { return snapshots_[(version / interval_) % snapshots_.size()]; }
+
+  std::vector<Delta> deltas_;      // deltas_[Slot(v)] leads from version v-1 to v
+  std::vector<State> snapshots_;   // full state of every version divisible by interval_
+  size_t interval_;
+  State newest_state_;
+  size_t oldest_{0};
+  size_t current_{0};
+  size_t newest_{0};
+};
+
+}  // namespace memento_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_DELTA_HISTORY_HPP
@@ -0,0 +1,85 @@
+/**
+ * 100M deposits with an undo and a redo after every fourth one, recorded the way BankAccount2 does it now
+ * (DeltaHistory) and the way it used to (one shared_ptr<Memento> per change in an unbounded vector).
+ * The shared_ptr version needs ~5 GB at 100M changes, so it only runs up to 10M.
+ */
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "delta_history.hpp"
+
+namespace {
+
+using namespace behavioral::memento_pattern;
+
+struct SharedMementoHistory {
+  struct Memento {
+    int balance_;
+  };
+
+  explicit SharedMementoHistory(int balance) : balance_(balance) {
+    changes_.push_back(std::make_shared<Memento>(Memento{balance}));
+  }
+
+  void Deposit(int amount) {
+    balance_ += amount;
+    changes_.resize(current_ + 1);
+    changes_.push_back(std::make_shared<Memento>(Memento{balance_}));
+    ++current_;
+  }
+  void Undo() {
+    if (current_ > 0) balance_ = changes_[--current_]->balance_;
+  }
+  void Redo() {
+    if (current_ + 1 < changes_.size()) balance_ = changes_[++current_]->balance_;
+  }
+
+  int balance_;
+  std::vector<std::shared_ptr<Memento>> changes_;
+  size_t current_{0};
+};
+
+void BM_DeltaHistory(benchmark::State& state) {
+  auto deposits = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    int balance{0};
+    DeltaHistory<int> history{balance, static_cast<size_t>(state.range(1))};
+    for (size_t i = 0; i < deposits; ++i) {
+      int amount = static_cast<int>(i & 0xff);
+      balance += amount;
+      history.Record(amount, balance);
+      if (i % 4 == 3) {
+        history.Undo(balance);
+        history.Redo(balance);
+      }
+    }
+    benchmark::DoNotOptimize(balance);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SharedMementoHistory(benchmark::State& state) {
+  auto deposits = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    SharedMementoHistory history{0};
+    for (size_t i = 0; i < deposits; ++i) {
+      history.Deposit(static_cast<int>(i & 0xff));
+      if (i % 4 == 3) {
+        history.Undo();
+        history.Redo();
+      }
+    }
+    benchmark::DoNotOptimize(history.balance_);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(BM_DeltaHistory)
+    ->ArgsProduct({{1000000, 100000000}, {1 << 10, 1 << 16, 1 << 20}})
+    ->ArgNames({"deposits", "capacity"})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SharedMementoHistory)->Arg(1000000)->Arg(10000000)->ArgName("deposits")->Unit(benchmark::kMillisecond);
@@ -12,9 +12,11 @@
  * Lets us roll back to the state when the token was generated.
  * May or may not directly expose state information.
  */
+#include <cstddef>
 #include <iostream>
-#include <memory>
-#include <vector>
+#include <optional>
+
+#include "delta_history.hpp"
 
 namespace behavioral {
 namespace memento_pattern {
@@ -29,46 +31,37 @@ class Memento {
   int balance_;
 };
 
+/**
+ * Mementos are plain values; the account's own history only stores the amount of every change, in a ring of
+ * `history` entries, so undo/redo never allocates and memory stays bounded.
+ */
 class BankAccount2 {
  public:
-  BankAccount2(int balance) : balance_(balance) {}
+  BankAccount2(int balance, size_t history = 1 << 16) : balance_(balance), changes_(balance, history) {}
 
-  std::shared_ptr<Memento> Deposit(int amount) {
+  Memento Deposit(int amount) {
     balance_ += amount;
-    auto m = std::make_shared<Memento>(balance_);
-    changes_.push_back(m);
-    ++current_;
-    return m;
+    changes_.Record(amount, balance_);
+    return Memento{balance_};
   }
 
-  void Restore(const std::shared_ptr<Memento>& m) {
-    if (m) {
-      balance_ = m->balance_;
-      changes_.push_back(m);
-      current_ = static_cast<int>(changes_.size()) - 1;
-    }
+  void Restore(const Memento& m) {
+    changes_.Record(m.balance_ - balance_, m.balance_);
+    balance_ = m.balance_;
   }
 
-  std::shared_ptr<Memento> Undo() {
-    if (current_ > 0) {
-      --current_;
-      auto m = changes_[static_cast<long unsigned int>(current_)];
-      balance_ = m->balance_;
-      return m;
-    }
-    return {};
+  std::optional<Memento> Undo() {
+    if (!changes_.Undo(balance_)) return std::nullopt;
+    return Memento{balance_};
   }
 
-  std::shared_ptr<Memento> Redo() {
-    if (current_ + 1 < static_cast<int>(changes_.size())) {
-      ++current_;
-      auto m = changes_[static_cast<long unsigned int>(current_)];
-      balance_ = m->balance_;
-      return m;
-    }
-    return {};
+  std::optional<Memento> Redo() {
+    if (!changes_.Redo(balance_)) return std::nullopt;
+    return Memento{balance_};
   }
 
+  int Balance() const { return balance_; }
+
   friend std::ostream& operator<<(std::ostream& os, const BankAccount2& ba) {
     os << "Balance: " << ba.balance_;
     return os;
@@ -76,8 +69,7 @@ class BankAccount2 {
 
  private:
   int balance_{0};
-  std::vector<std::shared_ptr<Memento>> changes_;
-  int current_{0};
+  DeltaHistory<int> changes_;
 };
 
 }  // namespace memento_pattern
@@ -103,6 +95,44 @@ TEST(MementoPatternTest, UsageOfTheMementoPattern) {
   std::cout << "Undo 2: " << ba << std::endl;
   ba.Redo();
   std::cout << "Redo: " << ba << std::endl;
+
+  ASSERT_EQ(150, ba.Balance());
+  ASSERT_TRUE(ba.Undo());
+  ASSERT_FALSE(ba.Undo());  // back at the opening balance
+  ASSERT_EQ(100, ba.Balance());
+}
+
+TEST(MementoPatternTest, RestoreAndNewChangesDropTheRedoHistory) {
+  BankAccount2 ba{0};
+  auto m = ba.Deposit(10);
+  ba.Deposit(20);
+  ba.Undo();
+  ba.Deposit(5);  // 15; the +20 can no longer be redone
+  ASSERT_FALSE(ba.Redo());
+
+  ba.Restore(m);
+  ASSERT_EQ(10, ba.Balance());
+  ASSERT_TRUE(ba.Undo());
+  ASSERT_EQ(15, ba.Balance());
+}
+
+TEST(MementoPatternTest, HistoryIsBounded) {
+  BankAccount2 ba{0, 100};
+  for (int i = 1; i <= 1000; ++i) ba.Deposit(i);
+
+  int undone{0};
+  while (ba.Undo()) ++undone;
+  ASSERT_EQ(100, undone);
+  ASSERT_EQ(900 * 901 / 2, ba.Balance());
+
+  DeltaHistory<int> history{0, 100, 8};
+  int balance{0};
+  for (int i = 1; i <= 1000; ++i) history.Record(i, balance += i);
+  for (size_t version = history.Oldest(); version <= history.Newest(); ++version) {
+    auto v = static_cast<int>(version);
+    ASSERT_EQ(v * (v + 1) / 2, *history.At(version)) << version;
+  }
+  ASSERT_FALSE(history.At(history.Oldest() - 1));
 }
 
 }  // namespace
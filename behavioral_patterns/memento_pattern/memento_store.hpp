@@ -0,0 +1,244 @@
+#ifndef BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_MEMENTO_STORE_HPP
+#define BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_MEMENTO_STORE_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace behavioral {
+namespace memento_pattern {
+
+/**
+ * Append-only, memory-mapped log of mementos that survives the process.
+ *
+ * Every version is either a full snapshot or a delta against the previous version, stored as opaque bytes in
+ * `<path>`. A fixed-size entry per version in `<path>.index` records where its bytes live and which snapshot it
+ * builds on, so any version is restored by jumping to that snapshot and replaying at most `snapshot_interval`
+ * deltas, never the whole history. Record bytes are written before their index entry, and the version count in the
+ * index header is bumped last, so if the process dies it loses at most the version being appended: the pages are
+ * shared with the kernel and reach the files anyway. That ordering does not hold on disk, where the kernel writes
+ * pages back in any order, so after a power loss or kernel crash only the versions covered by the last Sync() are
+ * guaranteed to be intact.
+ */
+class MementoStore {
+ public:
+  enum class Kind : uint32_t { snapshot = 0, delta = 1 };
+
+  struct Record {
+    Kind kind;
+    std::string_view data;  // valid until the next Append
+  };
+
+  // Opens the store at `path`, creating it if needed; versions written by earlier processes are kept.
+  explicit MementoStore(const std::string& path, size_t snapshot_interval = 64)
+      : interval_(std::max<size_t>(snapshot_interval, 1)),
+        data_(path, 0),
+        index_(path + ".index", sizeof(Header)) {
+    auto& header = Head();
+    if (header.magic == 0) header.magic = kMagic;
+    if (header.magic != kMagic) throw std::runtime_error("Not a memento store: " + path + ".index");
+    Validate(path);
+    if (header.versions > 0) {
+      auto& last = Entry(header.versions - 1);
+      end_ = Align(last.offset + last.size);
+      last_snapshot_ = last.kind == Kind::snapshot ? header.versions - 1 : last.snapshot;
+    }
+  }
+
+  MementoStore(const MementoStore&) = delete;
+  MementoStore& operator=(const MementoStore&) = delete;
+
+  size_t Versions() const { return static_cast<size_t>(Head().versions); }
+
+  // The first version must be a snapshot; afterwards one is due every `snapshot_interval` versions.
+  bool SnapshotDue() const { return Versions() == 0 || Versions() - last_snapshot_ >= interval_; }
+
+  // Both return the number of the new version.
+  size_t AppendSnapshot(std::string_view data) { return Append(Kind::snapshot, data); }
+  size_t AppendDelta(std::string_view data) {
+    if (Versions() == 0) throw std::logic_error("A memento store has to start with a snapshot");
+    return Append(Kind::delta, data);
+  }
+
+  Record Get(size_t version) const {
+    const auto& entry = Entry(Checked(version));
+    return {entry.kind, {data_.Data() + entry.offset, static_cast<size_t>(entry.size)}};
+  }
+
+  /**
+   * Rebuilds `version`: calls on_snapshot(bytes) with the closest snapshot at or before it, then on_delta(bytes)
+   * for every delta between that snapshot and `version`, in order.
+   */
+  template <typename OnSnapshot, typename OnDelta>
+  void Restore(size_t version, OnSnapshot&& on_snapshot, OnDelta&& on_delta) const {
+    const auto& entry = Entry(Checked(version));
+    auto first = entry.kind == Kind::snapshot ? version : static_cast<size_t>(entry.snapshot);
+    on_snapshot(Get(first).data);
+    for (auto v = first + 1; v <= version; ++v) on_delta(Get(v).data);
+  }
+
+  // Flushes both files to disk, data before index; without it the kernel writes them back in its own time and order.
+  void Sync() {
+    data_.Sync();
+    index_.Sync();
+  }
+
+  // Views trivially copyable values as record bytes and back.
+  template <typename T>
+  static std::string_view Bytes(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be stored as raw bytes");
+    return {reinterpret_cast<const char*>(&value), sizeof(T)};
+  }
+  template <typename T>
+  static T As(std::string_view bytes) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be stored as raw bytes");
+    if (bytes.size() != sizeof(T)) throw std::invalid_argument("Record has the wrong size");
+    T value;
+    std::memcpy(&value, bytes.data(), sizeof(T));
+    return value;
+  }
+
+ private:
+  static constexpr uint64_t kMagic = 0x4f544e454d454d31;
+
+  struct Header {
+    uint64_t magic;
+    uint64_t versions;
+  };
+
+  struct IndexEntry {
+    uint64_t offset;
+    uint32_t size;
+    Kind kind;
+    uint64_t snapshot;  // version the delta chain starts from
+  };
+
+  // A file mapped in full, grown by doubling.
+  class MappedFile {
+   public:
+    MappedFile(const std::string& path, size_t minimum) {
+      fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+      if (fd_ < 0) throw std::system_error(errno, std::generic_category(), "open " + path);
+      try {
+        struct stat status {};
+        if (::fstat(fd_, &status) != 0) Fail("fstat");
+        capacity_ = opened_size_ = static_cast<size_t>(status.st_size);
+        Reserve(std::max<size_t>(minimum, 1 << 16));
+      } catch (...) {
+        ::close(fd_);
+        throw;
+      }
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() {
+      if (data_) ::munmap(data_, capacity_);
+      ::close(fd_);
+    }
+
+    char* Data() const { return data_; }
+    size_t OpenedSize() const { return opened_size_; }  // of the file before it was grown to the first mapping
+
+    void Reserve(size_t size) {
+      if (data_ && size <= capacity_) return;
+      auto capacity = std::max(size, capacity_);
+      if (data_) capacity = std::max(capacity, 2 * capacity_);
+      if (capacity != capacity_ && ::ftruncate(fd_, static_cast<off_t>(capacity)) != 0) Fail("ftruncate");
+      if (data_) ::munmap(data_, capacity_);
+      auto mapped = ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+      if (mapped == MAP_FAILED) {
+        data_ = nullptr;
+        Fail("mmap");
+      }
+      data_ = static_cast<char*>(mapped);
+      capacity_ = capacity;
+    }
+
+    void Sync() {
+      if (::msync(data_, capacity_, MS_SYNC) != 0) Fail("msync");
+    }
+
+   private:
+    [[noreturn]] static void Fail(const char* what) { throw std::system_error(errno, std::generic_category(), what); }
+
+    int fd_{-1};
+    char* data_{nullptr};
+    size_t capacity_{0};
+    size_t opened_size_{0};
+  };
+
+  static uint64_t Align(uint64_t offset) { return (offset + 7) & ~uint64_t{7}; }
+
+  // Checks what an earlier process left behind against the file sizes, so a truncated or corrupt store throws here
+  // instead of being read out of bounds later.
+  void Validate(const std::string& path) const {
+    auto corrupt = [&path](const std::string& what) {
+      return std::runtime_error("Corrupt memento store " + path + ": " + what);
+    };
+    auto versions = Head().versions;
+    auto index_size = index_.OpenedSize();
+    if (index_size < sizeof(Header) || versions > (index_size - sizeof(Header)) / sizeof(IndexEntry)) {
+      if (versions > 0) throw corrupt("index holds fewer entries than its header counts");
+      return;
+    }
+    auto data_size = data_.OpenedSize();
+    for (uint64_t version = 0; version < versions; ++version) {
+      const auto& entry = Entry(version);
+      if (entry.offset > data_size || entry.size > data_size - entry.offset)
+        throw corrupt("version " + std::to_string(version) + " lies past the end of the data file");
+      if (entry.kind == Kind::snapshot) continue;
+      if (entry.kind != Kind::delta || entry.snapshot >= version || Entry(entry.snapshot).kind != Kind::snapshot)
+        throw corrupt("version " + std::to_string(version) + " does not build on a snapshot");
+    }
+  }
+
+  size_t Checked(size_t version) const {
+    if (version >= Versions()) throw std::out_of_range("No such version in the memento store");
+    return version;
+  }
+
+  size_t Append(Kind kind, std::string_view data) {
+    if (data.size() > UINT32_MAX) throw std::length_error("Memento is too large");
+    auto version = Versions();
+
+    data_.Reserve(static_cast<size_t>(end_) + data.size());
+    std::memcpy(data_.Data() + end_, data.data(), data.size());
+
+    index_.Reserve(sizeof(Header) + (version + 1) * sizeof(IndexEntry));
+    Entry(version) = IndexEntry{end_, static_cast<uint32_t>(data.size()), kind, last_snapshot_};
+    Head().versions = version + 1;
+
+    end_ = Align(end_ + data.size());
+    if (kind == Kind::snapshot) last_snapshot_ = version;
+    return version;
+  }
+
+  Header& Head() const { return *reinterpret_cast<Header*>(index_.Data()); }
+  IndexEntry& Entry(size_t version) const {
+    return reinterpret_cast<IndexEntry*>(index_.Data() + sizeof(Header))[version];
+  }
+
+  size_t interval_;
+  MappedFile data_;
+  MappedFile index_;
+  uint64_t end_{0};            // first free byte of the data file
+  uint64_t last_snapshot_{0};  // version of the newest snapshot
+};
+
+}  // namespace memento_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_MEMENTO_PATTERN_MEMENTO_STORE_HPP
@@ -0,0 +1,97 @@
+/**
+ * Write throughput of MementoStore (balance deltas with periodic snapshots, and 4 KB snapshots) and the latency of
+ * restoring a random version of a 1M version history, for several snapshot intervals.
+ * Files go to /tmp; nothing is msync'ed, the kernel writes pages back on its own.
+ */
+#include <cstddef>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "memento_store.hpp"
+
+namespace {
+
+using namespace behavioral::memento_pattern;
+
+const std::string kPath{"/tmp/memento_store_benchmark"};
+
+void RemoveStore() {
+  std::remove(kPath.c_str());
+  std::remove((kPath + ".index").c_str());
+}
+
+void FillBalances(MementoStore& store, size_t versions) {
+  int balance{0};
+  for (size_t i = 0; i < versions; ++i) {
+    int amount = static_cast<int>(i % 100);
+    balance += amount;
+    if (store.SnapshotDue())
+      store.AppendSnapshot(MementoStore::Bytes(balance));
+    else
+      store.AppendDelta(MementoStore::Bytes(amount));
+  }
+}
+
+void BM_AppendBalanceDeltas(benchmark::State& state) {
+  auto versions = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    RemoveStore();
+    {
+      MementoStore store{kPath};
+      state.ResumeTiming();
+      FillBalances(store, versions);
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  RemoveStore();
+}
+
+void BM_AppendSnapshots(benchmark::State& state) {
+  auto versions = static_cast<size_t>(state.range(0));
+  std::string snapshot(static_cast<size_t>(state.range(1)), 'x');
+  for (auto _ : state) {
+    state.PauseTiming();
+    RemoveStore();
+    {
+      MementoStore store{kPath};
+      state.ResumeTiming();
+      for (size_t i = 0; i < versions; ++i) store.AppendSnapshot(snapshot);
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(1));
+  RemoveStore();
+}
+
+void BM_RestoreRandomVersion(benchmark::State& state) {
+  const size_t versions{1000000};
+  RemoveStore();
+  MementoStore store{kPath, static_cast<size_t>(state.range(0))};
+  FillBalances(store, versions);
+
+  std::mt19937_64 random{42};
+  std::uniform_int_distribution<size_t> version{0, versions - 1};
+  for (auto _ : state) {
+    int balance{0};
+    store.Restore(
+        version(random), [&](std::string_view bytes) { balance = MementoStore::As<int>(bytes); },
+        [&](std::string_view bytes) { balance += MementoStore::As<int>(bytes); });
+    benchmark::DoNotOptimize(balance);
+  }
+  RemoveStore();
+}
+
+}  // namespace
+
+BENCHMARK(BM_AppendBalanceDeltas)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_AppendSnapshots)->Args({100000, 4096})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RestoreRandomVersion)->ArgName("snapshot_interval")->Arg(16)->Arg(64)->Arg(256);
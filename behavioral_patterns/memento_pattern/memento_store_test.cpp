@@ -0,0 +1,132 @@
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "memento_store.hpp"
+
+namespace {
+
+using namespace behavioral::memento_pattern;
+
+class MementoStoreTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = ::testing::TempDir() + "memento_store_" + ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    TearDown();
+  }
+  void TearDown() override {
+    std::remove(path_.c_str());
+    std::remove((path_ + ".index").c_str());
+  }
+
+  std::string path_;
+};
+
+// A bank account's balance: snapshots hold the balance, deltas the amount deposited.
+int RestoreBalance(const MementoStore& store, size_t version) {
+  int balance{0};
+  store.Restore(
+      version, [&](std::string_view bytes) { balance = MementoStore::As<int>(bytes); },
+      [&](std::string_view bytes) { balance += MementoStore::As<int>(bytes); });
+  return balance;
+}
+
+TEST_F(MementoStoreTest, BalanceHistorySurvivesReopening) {
+  std::vector<int> balances;
+  {
+    MementoStore store{path_, 16};
+    int balance{100};
+    store.AppendSnapshot(MementoStore::Bytes(balance));
+    balances.push_back(balance);
+    for (int amount = 1; amount < 1000; ++amount) {
+      balance += amount % 7 - 3;
+      if (store.SnapshotDue())
+        store.AppendSnapshot(MementoStore::Bytes(balance));
+      else
+        store.AppendDelta(MementoStore::Bytes(amount % 7 - 3));
+      balances.push_back(balance);
+    }
+  }
+
+  MementoStore store{path_, 16};  // as if after a restart
+  ASSERT_EQ(balances.size(), store.Versions());
+  for (size_t version : {size_t{0}, size_t{1}, size_t{15}, size_t{16}, size_t{17}, size_t{500}, size_t{999}})
+    ASSERT_EQ(balances[version], RestoreBalance(store, version)) << version;
+
+  // Appending carries on where the previous process stopped.
+  auto version = store.AppendDelta(MementoStore::Bytes(1));
+  ASSERT_EQ(balances.size(), version);
+  ASSERT_EQ(balances.back() + 1, RestoreBalance(store, version));
+}
+
+TEST_F(MementoStoreTest, TokenListHistory) {
+  // A token machine: snapshots hold every token value, deltas the one token added.
+  MementoStore store{path_, 4};
+  std::vector<int> tokens;
+  for (int token = 0; token < 50; ++token) {
+    tokens.push_back(token * token);
+    if (store.SnapshotDue())
+      store.AppendSnapshot({reinterpret_cast<const char*>(tokens.data()), tokens.size() * sizeof(int)});
+    else
+      store.AppendDelta(MementoStore::Bytes(tokens.back()));
+  }
+  ASSERT_EQ(MementoStore::Kind::snapshot, store.Get(0).kind);
+  ASSERT_EQ(MementoStore::Kind::delta, store.Get(1).kind);
+
+  std::vector<int> restored;
+  store.Restore(
+      37,
+      [&](std::string_view bytes) {
+        restored.resize(bytes.size() / sizeof(int));
+        std::memcpy(restored.data(), bytes.data(), bytes.size());
+      },
+      [&](std::string_view bytes) { restored.push_back(MementoStore::As<int>(bytes)); });
+  ASSERT_EQ(std::vector<int>(tokens.begin(), tokens.begin() + 38), restored);
+}
+
+TEST_F(MementoStoreTest, RejectsInvalidUse) {
+  MementoStore store{path_};
+  ASSERT_THROW(store.AppendDelta(MementoStore::Bytes(1)), std::logic_error);
+  store.AppendSnapshot(MementoStore::Bytes(1));
+  ASSERT_THROW(store.Get(1), std::out_of_range);
+  ASSERT_THROW(MementoStore::As<long>(store.Get(0).data), std::invalid_argument);
+}
+
+TEST_F(MementoStoreTest, CorruptFilesAreRejectedOnReopening) {
+  auto write = [this]() {
+    MementoStore store{path_};
+    int balance{100};
+    store.AppendSnapshot(MementoStore::Bytes(balance));
+    for (int i = 0; i < 10; ++i) store.AppendDelta(MementoStore::Bytes(i));
+  };
+
+  write();
+  ASSERT_EQ(0, ::truncate(path_.c_str(), 16));  // loses most of the records
+  ASSERT_THROW(MementoStore{path_}, std::runtime_error);
+
+  TearDown();
+  write();
+  {
+    auto index = std::fopen((path_ + ".index").c_str(), "r+b");
+    ASSERT_NE(nullptr, index);
+    uint64_t versions{uint64_t{1} << 40};  // far more than the index holds
+    std::fseek(index, sizeof(uint64_t), SEEK_SET);
+    std::fwrite(&versions, sizeof(versions), 1, index);
+    std::fclose(index);
+  }
+  ASSERT_THROW(MementoStore{path_}, std::runtime_error);
+
+  TearDown();
+  write();
+  MementoStore store{path_};  // intact files still open
+  ASSERT_EQ(11u, store.Versions());
+}
+
+}  // namespace
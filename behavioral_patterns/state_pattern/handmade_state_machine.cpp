@@ -2,71 +2,7 @@
 #include <unordered_map>
 #include <vector>
 
-namespace behavioral {
-namespace state_pattern {
-
-enum class State { off_hook, connecting, connected, on_hold, on_hook };
-
-inline std::ostream& operator<<(std::ostream& os, const State& s) {
-  switch (s) {
-    case State::off_hook:
-      os << "Off the hook";
-      break;
-    case State::connecting:
-      os << "Connecting";
-      break;
-    case State::connected:
-      os << "Connected";
-      break;
-    case State::on_hold:
-      os << "On hold";
-      break;
-    case State::on_hook:
-      os << "On hook";
-      break;
-  }
-  return os;
-}
-
-enum class Trigger {
-  call_dialed,
-  hung_up,
-  call_connected,
-  placed_on_hold,
-  taken_off_hold,
-  left_message,
-  stop_using_phone
-};
-
-inline std::ostream& operator<<(std::ostream& os, const Trigger& t) {
-  switch (t) {
-    case Trigger::call_dialed:
-      os << "Call dialed";
-      break;
-    case Trigger::hung_up:
-      os << "Hung up";
-      break;
-    case Trigger::call_connected:
-      os << "Call connected";
-      break;
-    case Trigger::placed_on_hold:
-      os << "Placed n hold";
-      break;
-    case Trigger::taken_off_hold:
-      os << "Taken off hold";
-      break;
-    case Trigger::left_message:
-      os << "Left message";
-      break;
-    case Trigger::stop_using_phone:
-      os << "Stop using phone";
-      break;
-  }
-  return os;
-}
-
-}  // namespace state_pattern
-}  // namespace behavioral
+#include "phone.hpp"
 
 // TEST---------------------------------------------------------------------------------------------------------------|
 
@@ -108,4 +44,26 @@ TEST(StatePatternTest, UsageOfTheStatePattern) {
   std::cout << "We are done using the phone\n";
 }
 
+TEST(StatePatternTest, CompileTimeTransitionTable) {
+  Phone phone{State::off_hook};
+  ASSERT_TRUE(phone.Fire(Trigger::call_dialed));
+  ASSERT_TRUE(phone.Fire(Trigger::call_connected));
+  ASSERT_TRUE(phone.Fire(Trigger::placed_on_hold));
+  ASSERT_EQ(State::on_hold, phone.CurrentState());
+
+  ASSERT_FALSE(phone.Fire(Trigger::call_dialed));  // not accepted while on hold
+  ASSERT_EQ(State::on_hold, phone.CurrentState());
+
+  ASSERT_TRUE(phone.Fire(Trigger::hung_up));
+  ASSERT_TRUE(phone.Fire(Trigger::stop_using_phone));
+  ASSERT_EQ(State::on_hook, phone.CurrentState());
+
+  static_assert(kPhoneTable.Next(State::connecting, Trigger::hung_up) == State::off_hook);
+
+  constexpr Rule<State, Trigger> kOneWay[] = {{State::off_hook, Trigger::call_dialed, State::connecting}};
+  constexpr TransitionTable<State, Trigger, kPhoneStates, kPhoneTriggers> kOneWayTable{kOneWay};
+  static_assert(!kOneWayTable.Reachable(State::off_hook));
+  static_assert(kOneWayTable.DeadEnds(State::on_hook) == 3);
+}
+
 }  // namespace
@@ -0,0 +1,337 @@
+#ifndef BEHAVIORAL_PATTERNS_STATE_PATTERN_HIERARCHICAL_STATE_MACHINE_HPP
+#define BEHAVIORAL_PATTERNS_STATE_PATTERN_HIERARCHICAL_STATE_MACHINE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace behavioral {
+namespace state_pattern {
+
+/**
+ * Fixed-capacity queue that any number of threads may push to and pop from without locks (Dmitry Vyukov's bounded
+ * MPMC queue). Each cell carries a sequence number telling producers and consumers whose turn it is, so the only
+ * contended operation is one compare-and-swap on the head or tail counter.
+ */
+template <typename T>
+class BoundedQueue {
+ public:
+  explicit BoundedQueue(size_t capacity) {
+    size_t size{2};
+    while (size < capacity) size *= 2;
+    cells_ = std::make_unique<Cell[]>(size);
+    for (size_t i = 0; i < size; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    mask_ = size - 1;
+  }
+
+  // False if the queue is full.
+  bool Push(const T& value) {
+    auto position = tail_.load(std::memory_order_relaxed);
+    while (true) {
+      auto& cell = cells_[position & mask_];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+      if (difference == 0) {
+        // seq_cst, unlike the head: HierarchicalStateMachine::Post() relies on this write being ordered before
+        // its own exchange on `scheduled_`.
+        if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+          cell.value = value;
+          cell.sequence.store(position + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // False if the queue is empty.
+  bool Pop(T& value) {
+    auto position = head_.load(std::memory_order_relaxed);
+    while (true) {
+      auto& cell = cells_[position & mask_];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      auto difference = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position + 1);
+      if (difference == 0) {
+        if (head_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          value = cell.value;
+          cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (difference < 0) {
+        return false;
+      } else {
+        position = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // May report an element whose push has not completed yet; Pop() then still fails.
+  bool Empty() const { return head_.load() == tail_.load(); }
+
+ private:
+  struct Cell {
+    std::atomic<size_t> sequence;
+    T value;
+  };
+
+  std::unique_ptr<Cell[]> cells_;
+  size_t mask_{0};
+  alignas(64) std::atomic<size_t> tail_{0};
+  alignas(64) std::atomic<size_t> head_{0};
+};
+
+template <typename Event>
+class EventPump;
+
+/**
+ * Hierarchical state machine built at run time:
+ *
+ *   HierarchicalStateMachine<Event> phone;
+ *   auto active = phone.AddState("active");
+ *   auto ringing = phone.AddState("ringing", active, on_enter, on_exit);
+ *   phone.AddTransition(active, Event::hang_up, idle);  // inherited by every state nested in `active`
+ *
+ * An event is handled by the innermost active state with a matching transition whose guard passes, so nested
+ * states inherit their ancestors' transitions. Taking a transition exits states from the current one up to the
+ * closest common ancestor of source and target, runs the transition's action, enters states down to the target
+ * and then follows the initial substates set with SetInitial().
+ *
+ * Events are not handled when posted but queued, in a lock-free queue that any thread may Post() to, and handled
+ * one at a time by Dispatch() (run-to-completion): an action that posts an event, even to its own machine, only
+ * queues it, so handlers never re-enter the machine. Dispatch() must not be called concurrently; attach machines
+ * to an EventPump to have one thread serve many of them.
+ */
+template <typename Event>
+class HierarchicalStateMachine {
+ public:
+  using StateId = size_t;
+  using Action = std::function<void()>;
+  using Guard = std::function<bool()>;
+
+  static constexpr StateId kRoot = 0;
+
+  explicit HierarchicalStateMachine(size_t queue_capacity = 64) : queue_(queue_capacity) {
+    states_.push_back(StateInfo{"root", kRoot, 0, kNone, {}, {}, {}});
+  }
+
+  HierarchicalStateMachine(const HierarchicalStateMachine&) = delete;
+  HierarchicalStateMachine& operator=(const HierarchicalStateMachine&) = delete;
+
+  StateId AddState(std::string name, StateId parent = kRoot, Action entry = {}, Action exit = {}) {
+    auto depth = Info(parent).depth + 1;
+    states_.push_back(StateInfo{std::move(name), parent, depth, kNone, std::move(entry), std::move(exit), {}});
+    auto id = states_.size() - 1;
+    if (Info(parent).initial == kNone) Info(parent).initial = id;  // the first child is the default
+    return id;
+  }
+
+  // Entering `composite` continues into `child`.
+  void SetInitial(StateId composite, StateId child) {
+    if (Info(child).parent != composite) throw std::invalid_argument("Initial state must be a direct child");
+    Info(composite).initial = child;
+  }
+
+  void AddTransition(StateId from, Event event, StateId to, Action action = {}, Guard guard = {}) {
+    if (to == kRoot || to >= states_.size()) throw std::invalid_argument("Invalid transition target");
+    Info(from).transitions.push_back(Transition{event, to, std::move(action), std::move(guard)});
+  }
+
+  // Enters the initial states, starting from the root.
+  void Start() {
+    current_ = kRoot;
+    EnterInitial();
+  }
+
+  // Thread-safe and lock-free once the machine is attached to its pump, if any; false if the event queue is full.
+  bool Post(Event event) {
+    if (!queue_.Push(event)) return false;
+    // Pairs with EventPump::PumpOne(), which clears scheduled_ and then checks the queue, while this pushes and then
+    // sets scheduled_. Each side writes one variable and reads the other, which only works if all four operations
+    // are seq_cst (the tail CAS in Push() included). With weaker ordering each side can miss the other's write, and
+    // the event would stay queued with nobody scheduling the machine.
+    if (pump_ && !scheduled_.exchange(true)) pump_->Schedule(this);
+    return true;
+  }
+
+  // Handles up to `budget` queued events, each to completion; returns how many were handled.
+  size_t Dispatch(size_t budget = SIZE_MAX) {
+    if (dispatching_) throw std::logic_error("Dispatch() called from inside a handler");
+    struct Reset {
+      bool& flag;
+      ~Reset() { flag = false; }
+    } reset{dispatching_ = true};
+    size_t handled{0};
+    Event event;
+    while (handled < budget && queue_.Pop(event)) {
+      Process(event);
+      ++handled;
+    }
+    return handled;
+  }
+
+  StateId Current() const { return current_; }
+  const std::string& Name(StateId state) const { return states_.at(state).name; }
+
+  // Whether `state` is the current state or one of its ancestors.
+  bool IsIn(StateId state) const {
+    for (auto s = current_;; s = states_[s].parent) {
+      if (s == state) return true;
+      if (s == kRoot) return false;
+    }
+  }
+
+ private:
+  friend class EventPump<Event>;
+
+  static constexpr StateId kNone = static_cast<StateId>(-1);
+
+  struct Transition {
+    Event event;
+    StateId to;
+    Action action;
+    Guard guard;
+  };
+
+  struct StateInfo {
+    std::string name;
+    StateId parent;
+    size_t depth;
+    StateId initial;
+    Action entry;
+    Action exit;
+    std::vector<Transition> transitions;
+  };
+
+  StateInfo& Info(StateId state) {
+    if (state >= states_.size()) throw std::out_of_range("Unknown state");
+    return states_[state];
+  }
+
+  void Process(Event event) {
+    for (auto source = current_;; source = states_[source].parent) {
+      for (auto& transition : states_[source].transitions) {
+        if (transition.event == event && (!transition.guard || transition.guard())) {
+          Take(source, transition);
+          return;
+        }
+      }
+      if (source == kRoot) return;  // nobody handles it; the event is dropped
+    }
+  }
+
+  void Take(StateId source, const Transition& transition) {
+    auto target = transition.to;
+    auto ancestor = CommonAncestor(source, target);
+
+    for (; current_ != ancestor; current_ = states_[current_].parent)
+      if (states_[current_].exit) states_[current_].exit();
+
+    if (transition.action) transition.action();
+
+    EnterDownTo(ancestor, target);
+    EnterInitial();
+  }
+
+  // Enters the states below `ancestor` on the way to `target`, outermost first.
+  void EnterDownTo(StateId ancestor, StateId target) {
+    if (states_[target].parent != ancestor) EnterDownTo(ancestor, states_[target].parent);
+    current_ = target;
+    if (states_[current_].entry) states_[current_].entry();
+  }
+
+  void EnterInitial() {
+    while (states_[current_].initial != kNone) {
+      current_ = states_[current_].initial;
+      if (states_[current_].entry) states_[current_].entry();
+    }
+  }
+
+  // Deepest state that strictly contains both, so a transition to the source itself or to an ancestor exits and
+  // re-enters it.
+  StateId CommonAncestor(StateId a, StateId b) const {
+    a = states_[a].parent;
+    b = states_[b].parent;
+    while (states_[a].depth > states_[b].depth) a = states_[a].parent;
+    while (states_[b].depth > states_[a].depth) b = states_[b].parent;
+    while (a != b) {
+      a = states_[a].parent;
+      b = states_[b].parent;
+    }
+    return a;
+  }
+
+  std::vector<StateInfo> states_;
+  StateId current_{kRoot};
+  BoundedQueue<Event> queue_;
+  bool dispatching_{false};
+  std::atomic<bool> scheduled_{false};  // queued on pump_, or being dispatched by it
+  EventPump<Event>* pump_{nullptr};  // written once by EventPump::Attach(), before other threads post
+};
+
+/**
+ * Serves many machines from one thread. A machine is queued here when an event is posted to it while it was idle,
+ * so the pump never scans machines without work. Each turn handles at most `budget` events of one machine before
+ * moving on to the next ready one, so a busy machine cannot starve the others: an event waits for at most
+ * (ready machines ahead of it) x budget dispatches.
+ */
+template <typename Event>
+class EventPump {
+ public:
+  using Machine = HierarchicalStateMachine<Event>;
+
+  explicit EventPump(size_t max_machines, size_t budget = 16)
+      : ready_(max_machines), budget_(budget), max_(max_machines) {}
+
+  // Not synchronised with Post(): attach a machine before any other thread can post to it, e.g. before the threads
+  // that post are started. Events posted before Attach() are scheduled by it.
+  void Attach(Machine& machine) {
+    if (attached_ == max_) throw std::length_error("Too many machines for this pump");
+    ++attached_;
+    machine.pump_ = this;
+    if (!machine.queue_.Empty() && !machine.scheduled_.exchange(true)) Schedule(&machine);
+  }
+
+  // Gives one ready machine its turn; returns the number of events handled, 0 if no machine was ready.
+  size_t PumpOne() {
+    Machine* machine{nullptr};
+    if (!ready_.Pop(machine)) return 0;
+    auto handled = machine->Dispatch(budget_);
+    machine->scheduled_.store(false);  // seq_cst, see HierarchicalStateMachine::Post()
+    if (!machine->queue_.Empty() && !machine->scheduled_.exchange(true)) Schedule(machine);
+    return handled;
+  }
+
+  // Pumps until no machine has events left; returns the number of events handled.
+  size_t RunUntilIdle() {
+    size_t handled{0};
+    while (!ready_.Empty()) handled += PumpOne();
+    return handled;
+  }
+
+ private:
+  friend Machine;
+
+  // Every machine is queued at most once and at most max_machines are attached, so this never fails.
+  void Schedule(Machine* machine) { ready_.Push(machine); }
+
+  BoundedQueue<Machine*> ready_;
+  size_t budget_;
+  size_t max_;
+  size_t attached_{0};
+};
+
+}  // namespace state_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STATE_PATTERN_HIERARCHICAL_STATE_MACHINE_HPP
@@ -0,0 +1,87 @@
+/**
+ * Dispatch latency of one EventPump serving thousands of hierarchical machines: every iteration posts an event to
+ * `burst` distinct random machines, then pumps until idle. Latency is the time from Post() to the end of the
+ * transition's action; p50, p99 and max over the whole run are reported as counters, in nanoseconds.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "hierarchical_state_machine.hpp"
+
+namespace {
+
+using namespace behavioral::state_pattern;
+using Clock = std::chrono::steady_clock;
+
+enum class Switch { toggle };
+
+// off <-> on, both nested in `powered`, so every toggle also runs through the hierarchy.
+struct Lamp {
+  using Machine = HierarchicalStateMachine<Switch>;
+
+  explicit Lamp(std::vector<int64_t>& latencies) {
+    auto powered = machine.AddState("powered");
+    auto off = machine.AddState("off", powered);
+    auto on = machine.AddState("on", powered);
+    auto record = [this, &latencies]() {
+      latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - posted).count());
+    };
+    machine.AddTransition(off, Switch::toggle, on, record);
+    machine.AddTransition(on, Switch::toggle, off, record);
+    machine.Start();
+  }
+
+  Machine machine;
+  Clock::time_point posted;
+};
+
+void BM_DispatchLatency(benchmark::State& state) {
+  auto count = static_cast<size_t>(state.range(0));
+  auto burst = static_cast<size_t>(state.range(1));
+  if (burst > count) {
+    state.SkipWithError("burst must not exceed the number of machines");
+    return;
+  }
+  std::vector<int64_t> latencies;
+  latencies.reserve(static_cast<size_t>(state.max_iterations) * burst);  // no reallocation while timing
+  std::vector<std::unique_ptr<Lamp>> lamps;
+  EventPump<Switch> pump{count};
+  for (size_t i = 0; i < count; ++i) {
+    lamps.push_back(std::make_unique<Lamp>(latencies));
+    pump.Attach(lamps.back()->machine);
+  }
+  std::vector<size_t> order(count);
+  for (size_t i = 0; i < count; ++i) order[i] = i;
+  std::mt19937 random{42};
+
+  for (auto _ : state) {
+    // Partial shuffle: each lamp is posted to at most once per burst, so `posted` is the time of its only event.
+    for (size_t i = 0; i < burst; ++i) {
+      std::swap(order[i], order[std::uniform_int_distribution<size_t>{i, count - 1}(random)]);
+      auto& lamp = *lamps[order[i]];
+      lamp.posted = Clock::now();
+      lamp.machine.Post(Switch::toggle);
+    }
+    pump.RunUntilIdle();
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    return static_cast<double>(latencies[static_cast<size_t>(p * static_cast<double>(latencies.size() - 1))]);
+  };
+  state.counters["p50_ns"] = percentile(0.50);
+  state.counters["p99_ns"] = percentile(0.99);
+  state.counters["max_ns"] = percentile(1.0);
+  state.SetItemsProcessed(static_cast<int64_t>(latencies.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_DispatchLatency)->Args({1000, 64})->Args({10000, 64})->Args({10000, 1024});
@@ -0,0 +1,128 @@
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "hierarchical_state_machine.hpp"
+
+namespace {
+
+using namespace behavioral::state_pattern;
+
+enum class Call { dial, answer, hold, resume, hang_up, redial };
+
+/**
+ *   idle      active
+ *            /      \
+ *      ringing     connected
+ *                  /       \
+ *            talking      on_hold
+ */
+struct CallMachine {
+  using Machine = HierarchicalStateMachine<Call>;
+
+  explicit CallMachine(size_t queue_capacity = 64) : machine(queue_capacity) {
+    auto logged = [this](std::string entry) { return [this, entry]() { log += entry + " "; }; };
+    idle = machine.AddState("idle", Machine::kRoot, logged("+idle"), logged("-idle"));
+    active = machine.AddState("active", Machine::kRoot, logged("+active"), logged("-active"));
+    ringing = machine.AddState("ringing", active, logged("+ringing"), logged("-ringing"));
+    connected = machine.AddState("connected", active, logged("+connected"), logged("-connected"));
+    talking = machine.AddState("talking", connected, logged("+talking"), logged("-talking"));
+    on_hold = machine.AddState("on_hold", connected, logged("+on_hold"), logged("-on_hold"));
+
+    machine.AddTransition(idle, Call::dial, active);
+    machine.AddTransition(ringing, Call::answer, connected);
+    machine.AddTransition(talking, Call::hold, on_hold, {}, [this]() { return hold_allowed; });
+    machine.AddTransition(on_hold, Call::resume, talking);
+    machine.AddTransition(active, Call::hang_up, idle, logged("hangup"));  // inherited by every active state
+    // Redial posts to its own machine from inside a handler; it is queued, never handled re-entrantly.
+    machine.AddTransition(active, Call::redial, idle, [this]() {
+      log += "redial ";
+      machine.Post(Call::dial);
+    });
+    machine.Start();
+  }
+
+  void Fire(Call call) {
+    machine.Post(call);
+    machine.Dispatch();
+  }
+
+  Machine machine;
+  Machine::StateId idle, active, ringing, connected, talking, on_hold;
+  bool hold_allowed{true};
+  std::string log;
+};
+
+TEST(HierarchicalStateMachineTest, NestedStatesEntryExitAndGuards) {
+  CallMachine call;
+  ASSERT_EQ(call.idle, call.machine.Current());
+  ASSERT_EQ("+idle ", call.log);
+
+  call.log.clear();
+  call.Fire(Call::dial);
+  ASSERT_EQ("-idle +active +ringing ", call.log);  // entering active continues into its first child
+
+  call.Fire(Call::answer);
+  call.Fire(Call::hold);
+  ASSERT_EQ(call.on_hold, call.machine.Current());
+  ASSERT_TRUE(call.machine.IsIn(call.connected));
+  ASSERT_TRUE(call.machine.IsIn(call.active));
+
+  call.Fire(Call::resume);
+  call.hold_allowed = false;
+  call.Fire(Call::hold);  // rejected by the guard
+  ASSERT_EQ(call.talking, call.machine.Current());
+
+  call.log.clear();
+  call.Fire(Call::hang_up);  // handled by `active`, two levels up
+  ASSERT_EQ("-talking -connected -active hangup +idle ", call.log);
+
+  call.Fire(Call::answer);  // not handled anywhere in idle: dropped
+  ASSERT_EQ(call.idle, call.machine.Current());
+}
+
+TEST(HierarchicalStateMachineTest, RunToCompletion) {
+  CallMachine call;
+  call.Fire(Call::dial);
+  call.log.clear();
+
+  call.machine.Post(Call::redial);
+  ASSERT_EQ(2u, call.machine.Dispatch());  // the redial, then the dial it queued
+  ASSERT_EQ("-ringing -active redial +idle -idle +active +ringing ", call.log);
+
+  CallMachine small{2};
+  ASSERT_TRUE(small.machine.Post(Call::dial));
+  ASSERT_TRUE(small.machine.Post(Call::answer));
+  ASSERT_FALSE(small.machine.Post(Call::hold));  // queue full
+  ASSERT_EQ(1u, small.machine.Dispatch(1));
+  ASSERT_EQ(small.ringing, small.machine.Current());
+}
+
+TEST(HierarchicalStateMachineTest, OnePumpServesManyMachines) {
+  const size_t count{1000};
+  std::vector<std::unique_ptr<CallMachine>> calls;
+  EventPump<Call> pump{count, 2};
+  for (size_t i = 0; i < count; ++i) {
+    calls.push_back(std::make_unique<CallMachine>());
+    pump.Attach(calls.back()->machine);
+  }
+
+  std::thread producer{[&calls]() {
+    for (auto& call : calls) {
+      call->machine.Post(Call::dial);
+      call->machine.Post(Call::answer);
+      call->machine.Post(Call::hold);
+    }
+  }};
+  size_t handled{0};
+  while (handled < 3 * count) handled += pump.PumpOne();
+  producer.join();
+
+  ASSERT_EQ(0u, pump.RunUntilIdle());
+  for (auto& call : calls) ASSERT_EQ(call->on_hold, call->machine.Current());
+}
+
+}  // namespace
@@ -0,0 +1,84 @@
+#ifndef BEHAVIORAL_PATTERNS_STATE_PATTERN_LIGHT_SWITCH_HPP
+#define BEHAVIORAL_PATTERNS_STATE_PATTERN_LIGHT_SWITCH_HPP
+
+#include <iostream>
+
+namespace behavioral {
+namespace state_pattern {
+
+class LightSwitch;
+
+struct LightState {
+  virtual ~LightState() = default;
+
+  virtual void On(LightSwitch* ls);
+  virtual void Off(LightSwitch* ls);
+};
+
+/**
+ * States hold no data of their own, so each one is a flyweight: a single shared instance that every LightSwitch
+ * points to. A transition only swaps the switch's state pointer; nothing is allocated or has to be deleted.
+ */
+struct OnState : public LightState {
+  static OnState& Instance() {
+    static OnState instance;
+    return instance;
+  }
+
+  void Off(LightSwitch* ls) override;
+
+ private:
+  OnState() = default;
+};
+
+struct OffState : public LightState {
+  static OffState& Instance() {
+    static OffState instance;
+    return instance;
+  }
+
+  void On(LightSwitch* ls) override;
+
+ private:
+  OffState() = default;
+};
+
+class LightSwitch {
+ public:
+  explicit LightSwitch(std::ostream& log = std::cout) : log_(log) { log_ << "Light is switched off!\n"; }
+
+  void SetState(LightState* state) { this->state_ = state; }
+
+  void On() { state_->On(this); }
+
+  void Off() { state_->Off(this); }
+
+  bool IsOn() const { return state_ == &OnState::Instance(); }
+
+  std::ostream& Log() { return log_; }
+
+ private:
+  LightState* state_{&OffState::Instance()};
+  std::ostream& log_;
+};
+
+inline void LightState::On(LightSwitch* ls) { ls->Log() << "Light is already on.\n"; }
+
+inline void LightState::Off(LightSwitch* ls) { ls->Log() << "Light is already off.\n"; }
+
+inline void OnState::Off(LightSwitch* ls) {
+  ls->Log() << "Switching light off...\n";
+  ls->SetState(&OffState::Instance());
+  ls->Log() << "Light is switched off!\n";
+}
+
+inline void OffState::On(LightSwitch* ls) {
+  ls->Log() << "Switching light on...\n";
+  ls->SetState(&OnState::Instance());
+  ls->Log() << "Light is turned on!\n";
+}
+
+}  // namespace state_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STATE_PATTERN_LIGHT_SWITCH_HPP
@@ -0,0 +1,75 @@
+/**
+ * Soak test: toggles a LightSwitch 100M times and reports the peak resident set size before and after, which stays
+ * flat with flyweight states. The replaced design, which allocated a new state on every transition and never freed
+ * the old one, is reproduced for 10M toggles for comparison; it grows by roughly 32 bytes per toggle.
+ * All messages go to a stream without a buffer, which discards them.
+ */
+#include <sys/resource.h>
+
+#include <cstdint>
+#include <ostream>
+
+#include "benchmark/benchmark.h"
+#include "light_switch.hpp"
+
+namespace {
+
+using namespace behavioral::state_pattern;
+
+long PeakRssKb() {
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+struct LeakyLightSwitch {
+  struct LeakyState {
+    virtual ~LeakyState() = default;
+    virtual void Toggle(LeakyLightSwitch& ls) = 0;
+  };
+  struct LeakyOn : LeakyState {
+    void Toggle(LeakyLightSwitch& ls) override;
+  };
+  struct LeakyOff : LeakyState {
+    void Toggle(LeakyLightSwitch& ls) override { ls.state_ = new LeakyOn(); }
+  };
+
+  LeakyState* state_{new LeakyOff()};
+};
+
+void LeakyLightSwitch::LeakyOn::Toggle(LeakyLightSwitch& ls) { ls.state_ = new LeakyOff(); }
+
+void BM_FlyweightToggles(benchmark::State& state) {
+  std::ostream discard{nullptr};
+  auto toggles = state.range(0);
+  auto rss_before = PeakRssKb();
+  for (auto _ : state) {
+    LightSwitch ls{discard};
+    for (int64_t i = 0; i < toggles; i += 2) {
+      ls.On();
+      ls.Off();
+    }
+    benchmark::DoNotOptimize(ls.IsOn());
+  }
+  state.counters["peak_rss_before_kb"] = static_cast<double>(rss_before);
+  state.counters["peak_rss_after_kb"] = static_cast<double>(PeakRssKb());
+  state.SetItemsProcessed(state.iterations() * toggles);
+}
+
+void BM_LeakyToggles(benchmark::State& state) {
+  auto toggles = state.range(0);
+  auto rss_before = PeakRssKb();
+  for (auto _ : state) {
+    LeakyLightSwitch ls;
+    for (int64_t i = 0; i < toggles; ++i) ls.state_->Toggle(ls);
+    benchmark::DoNotOptimize(ls.state_);
+  }
+  state.counters["peak_rss_before_kb"] = static_cast<double>(rss_before);
+  state.counters["peak_rss_after_kb"] = static_cast<double>(PeakRssKb());
+  state.SetItemsProcessed(state.iterations() * toggles);
+}
+
+}  // namespace
+
+BENCHMARK(BM_FlyweightToggles)->Arg(100000000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LeakyToggles)->Arg(10000000)->Iterations(1)->Unit(benchmark::kMillisecond);
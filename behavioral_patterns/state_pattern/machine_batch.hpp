@@ -0,0 +1,141 @@
+#ifndef BEHAVIORAL_PATTERNS_STATE_PATTERN_MACHINE_BATCH_HPP
+#define BEHAVIORAL_PATTERNS_STATE_PATTERN_MACHINE_BATCH_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define BEHAVIORAL_STATE_PATTERN_AVX2 1
+#endif
+
+#include "behavioral_patterns/common/joining_threads.hpp"
+#include "transition_table.hpp"
+
+namespace behavioral {
+namespace state_pattern {
+
+// Row `state` of the result holds the state each trigger leads to, or `state` itself if it does not accept it.
+template <size_t kRow, typename Table>
+constexpr auto DenseRows(const Table& table) {
+  using State = typename Table::StateType;
+  using Trigger = typename Table::TriggerType;
+  std::array<uint8_t, Table::kStates * kRow> rows{};
+  for (size_t state = 0; state < Table::kStates; ++state) {
+    for (size_t trigger = 0; trigger < kRow; ++trigger) {
+      auto next = trigger < Table::kTriggers ? table.Next(static_cast<State>(state), static_cast<Trigger>(trigger))
+                                             : Table::kNone;
+      rows[state * kRow + trigger] = static_cast<uint8_t>(next == Table::kNone ? state : static_cast<size_t>(next));
+    }
+  }
+  return rows;
+}
+
+/**
+ * Millions of independent machines over the same constexpr TransitionTable, stored data-oriented: one byte of
+ * state per machine in a contiguous array instead of one object per machine.
+ *
+ * Fire() applies one trigger to every machine. The table is compiled into a 16-byte row of next states per state
+ * (a trigger the state does not accept maps back to the state itself), so a machine's step is a single load of
+ * row[state][trigger]. On x86-64 CPUs with AVX2, 32 machines are stepped at once: each row is a byte shuffle
+ * indexed by the triggers, and the results are blended by comparing the current states against that row's state.
+ */
+template <const auto& kTable>
+class MachineBatch {
+ public:
+  using Table = std::remove_cv_t<std::remove_reference_t<decltype(kTable)>>;
+  using State = typename Table::StateType;
+  using Trigger = typename Table::TriggerType;
+
+  static_assert(sizeof(State) == 1 && sizeof(Trigger) == 1, "States and triggers must be stored in one byte");
+
+  MachineBatch(size_t count, State initial) : states_(count, static_cast<uint8_t>(initial)) {}
+
+  size_t size() const { return states_.size(); }
+  State operator[](size_t machine) const { return static_cast<State>(states_[machine]); }
+
+  // triggers[i] is fired at machine i; every trigger must be a valid Trigger value.
+  void Fire(const std::vector<Trigger>& triggers) { FireRange(Checked(triggers), 0, size()); }
+
+  // Same as Fire(), with the machines split into contiguous ranges across `threads` threads.
+  void Fire(const std::vector<Trigger>& triggers, size_t threads) {
+    auto data = Checked(triggers);
+    threads = std::max<size_t>(1, std::min(threads, size() / 4096 + 1));
+    // Ranges are whole cache lines, starting from the first 64-byte boundary inside the array, so no two threads
+    // write to the same line; the first thread also takes the machines before that boundary.
+    auto per_thread = (size() / threads + 63) & ~size_t{63};
+    auto skew = static_cast<size_t>(-reinterpret_cast<uintptr_t>(states_.data()) & 63);
+
+    common::JoiningThreads pool;
+    for (size_t begin = skew + per_thread; begin < size(); begin += per_thread)
+      pool.Start([this, data, begin, per_thread]() { FireRange(data, begin, begin + per_thread); });
+    FireRange(data, 0, skew + per_thread);
+  }
+
+  // One machine at a time, without SIMD; the reference the vectorised path is tested against.
+  void FireScalar(const std::vector<Trigger>& triggers) {
+    auto data = Checked(triggers);
+    FireScalar(data, 0, size());
+  }
+
+ private:
+  static constexpr size_t kStates = Table::kStates;
+  static constexpr size_t kRow = 16;
+  static constexpr auto kRows = DenseRows<kRow>(kTable);
+
+  const uint8_t* Checked(const std::vector<Trigger>& triggers) const {
+    static_assert(Table::kTriggers <= kRow, "Rows hold up to 16 triggers");
+    if (triggers.size() != size()) throw std::invalid_argument("Need exactly one trigger per machine");
+    return reinterpret_cast<const uint8_t*>(triggers.data());
+  }
+
+  void FireRange(const uint8_t* triggers, size_t begin, size_t end) {
+    end = std::min(end, size());
+    if (begin >= end) return;
+#ifdef BEHAVIORAL_STATE_PATTERN_AVX2
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    if (avx2) begin = FireAvx2(triggers, begin, end);
+#endif
+    FireScalar(triggers, begin, end);
+  }
+
+  void FireScalar(const uint8_t* triggers, size_t begin, size_t end) {
+    for (auto i = begin; i < end; ++i) states_[i] = kRows[states_[i] * kRow + triggers[i]];
+  }
+
+#ifdef BEHAVIORAL_STATE_PATTERN_AVX2
+  // Returns the first machine left for the scalar loop.
+  __attribute__((target("avx2"))) size_t FireAvx2(const uint8_t* triggers, size_t begin, size_t end) {
+    __m256i rows[kStates];
+    for (size_t state = 0; state < kStates; ++state) {
+      auto row = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&kRows[state * kRow]));
+      rows[state] = _mm256_broadcastsi128_si256(row);
+    }
+
+    auto states = states_.data();
+    for (; begin + 32 <= end; begin += 32) {
+      auto current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(states + begin));
+      auto fired = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(triggers + begin));
+      auto next = current;
+      for (size_t state = 0; state < kStates; ++state) {
+        auto in_state = _mm256_cmpeq_epi8(current, _mm256_set1_epi8(static_cast<char>(state)));
+        next = _mm256_blendv_epi8(next, _mm256_shuffle_epi8(rows[state], fired), in_state);
+      }
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(states + begin), next);
+    }
+    return begin;
+  }
+#endif
+
+  std::vector<uint8_t> states_;
+};
+
+}  // namespace state_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STATE_PATTERN_MACHINE_BATCH_HPP
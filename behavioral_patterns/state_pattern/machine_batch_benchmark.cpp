@@ -0,0 +1,73 @@
+/**
+ * One trigger per machine for 16M phone state machines per iteration: one Phone object per session against
+ * MachineBatch, scalar, vectorised, and across threads (compare the threads:N rows on a multi-core machine).
+ */
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "machine_batch.hpp"
+#include "phone.hpp"
+
+namespace {
+
+using namespace behavioral::state_pattern;
+
+const size_t kMachines{1 << 24};
+
+// A few different batches, so machines do not settle into a fixed point.
+const std::vector<std::vector<Trigger>>& TriggerBatches() {
+  static const auto batches = []() {
+    std::mt19937 random{42};
+    std::uniform_int_distribution<int> trigger{0, static_cast<int>(kPhoneTriggers) - 1};
+    std::vector<std::vector<Trigger>> result(4, std::vector<Trigger>(kMachines));
+    for (auto& batch : result)
+      for (auto& t : batch) t = static_cast<Trigger>(trigger(random));
+    return result;
+  }();
+  return batches;
+}
+
+void BM_PhoneObjects(benchmark::State& state) {
+  auto& batches = TriggerBatches();
+  std::vector<Phone> phones(kMachines, Phone{State::off_hook});
+  size_t round{0};
+  for (auto _ : state) {
+    auto& triggers = batches[round++ % batches.size()];
+    for (size_t i = 0; i < kMachines; ++i) phones[i].Fire(triggers[i]);
+    benchmark::DoNotOptimize(phones.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kMachines));
+}
+
+void BM_BatchScalar(benchmark::State& state) {
+  auto& batches = TriggerBatches();
+  MachineBatch<kPhoneTable> machines{kMachines, State::off_hook};
+  size_t round{0};
+  for (auto _ : state) machines.FireScalar(batches[round++ % batches.size()]);
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kMachines));
+}
+
+void BM_BatchVectorised(benchmark::State& state) {
+  auto& batches = TriggerBatches();
+  MachineBatch<kPhoneTable> machines{kMachines, State::off_hook};
+  auto threads = static_cast<size_t>(state.range(0));
+  size_t round{0};
+  for (auto _ : state) machines.Fire(batches[round++ % batches.size()], threads);
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kMachines));
+}
+
+}  // namespace
+
+BENCHMARK(BM_PhoneObjects)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BatchScalar)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BatchVectorised)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
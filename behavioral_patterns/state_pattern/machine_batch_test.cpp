@@ -0,0 +1,52 @@
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "machine_batch.hpp"
+#include "phone.hpp"
+
+namespace {
+
+using namespace behavioral::state_pattern;
+
+std::vector<Trigger> RandomTriggers(size_t count, std::mt19937& random) {
+  std::uniform_int_distribution<int> trigger{0, static_cast<int>(kPhoneTriggers) - 1};
+  std::vector<Trigger> triggers(count);
+  for (auto& t : triggers) t = static_cast<Trigger>(trigger(random));
+  return triggers;
+}
+
+TEST(MachineBatchTest, MatchesIndividualMachines) {
+  const size_t count{100003};  // not a multiple of the vector width
+  MachineBatch<kPhoneTable> batch{count, State::off_hook};
+  MachineBatch<kPhoneTable> scalar{count, State::off_hook};
+  MachineBatch<kPhoneTable> threaded{count, State::off_hook};
+  std::vector<Phone> phones(count, Phone{State::off_hook});
+
+  std::mt19937 random{7};
+  for (int step = 0; step < 20; ++step) {
+    auto triggers = RandomTriggers(count, random);
+    batch.Fire(triggers);
+    scalar.FireScalar(triggers);
+    threaded.Fire(triggers, 3);
+    for (size_t i = 0; i < count; ++i) phones[i].Fire(triggers[i]);
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    ASSERT_EQ(phones[i].CurrentState(), batch[i]) << i;
+    ASSERT_EQ(phones[i].CurrentState(), scalar[i]) << i;
+    ASSERT_EQ(phones[i].CurrentState(), threaded[i]) << i;
+  }
+}
+
+TEST(MachineBatchTest, NeedsOneTriggerPerMachine) {
+  MachineBatch<kPhoneTable> batch{10, State::off_hook};
+  ASSERT_THROW(batch.Fire(std::vector<Trigger>(9, Trigger::hung_up)), std::invalid_argument);
+
+  batch.Fire(std::vector<Trigger>(10, Trigger::call_dialed));
+  ASSERT_EQ(State::connecting, batch[9]);
+}
+
+}  // namespace
@@ -0,0 +1,97 @@
+#ifndef BEHAVIORAL_PATTERNS_STATE_PATTERN_PHONE_HPP
+#define BEHAVIORAL_PATTERNS_STATE_PATTERN_PHONE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+#include "transition_table.hpp"
+
+namespace behavioral {
+namespace state_pattern {
+
+enum class State : uint8_t { off_hook, connecting, connected, on_hold, on_hook };
+
+inline std::ostream& operator<<(std::ostream& os, const State& s) {
+  switch (s) {
+    case State::off_hook:
+      os << "Off the hook";
+      break;
+    case State::connecting:
+      os << "Connecting";
+      break;
+    case State::connected:
+      os << "Connected";
+      break;
+    case State::on_hold:
+      os << "On hold";
+      break;
+    case State::on_hook:
+      os << "On hook";
+      break;
+  }
+  return os;
+}
+
+enum class Trigger : uint8_t {
+  call_dialed,
+  hung_up,
+  call_connected,
+  placed_on_hold,
+  taken_off_hold,
+  left_message,
+  stop_using_phone
+};
+
+inline std::ostream& operator<<(std::ostream& os, const Trigger& t) {
+  switch (t) {
+    case Trigger::call_dialed:
+      os << "Call dialed";
+      break;
+    case Trigger::hung_up:
+      os << "Hung up";
+      break;
+    case Trigger::call_connected:
+      os << "Call connected";
+      break;
+    case Trigger::placed_on_hold:
+      os << "Placed n hold";
+      break;
+    case Trigger::taken_off_hold:
+      os << "Taken off hold";
+      break;
+    case Trigger::left_message:
+      os << "Left message";
+      break;
+    case Trigger::stop_using_phone:
+      os << "Stop using phone";
+      break;
+  }
+  return os;
+}
+
+constexpr size_t kPhoneStates{5};
+constexpr size_t kPhoneTriggers{7};
+
+inline constexpr Rule<State, Trigger> kPhoneRules[] = {
+    {State::off_hook, Trigger::call_dialed, State::connecting},
+    {State::off_hook, Trigger::stop_using_phone, State::on_hook},
+    {State::connecting, Trigger::hung_up, State::off_hook},
+    {State::connecting, Trigger::call_connected, State::connected},
+    {State::connected, Trigger::left_message, State::off_hook},
+    {State::connected, Trigger::hung_up, State::off_hook},
+    {State::connected, Trigger::placed_on_hold, State::on_hold},
+    {State::on_hold, Trigger::taken_off_hold, State::connected},
+    {State::on_hold, Trigger::hung_up, State::off_hook},
+};
+
+inline constexpr TransitionTable<State, Trigger, kPhoneStates, kPhoneTriggers> kPhoneTable{kPhoneRules};
+static_assert(kPhoneTable.Reachable(State::off_hook), "Every state of the phone must be reachable");
+static_assert(kPhoneTable.DeadEnds(State::on_hook) == 0, "Only on_hook may end the phone call");
+
+using Phone = StateMachine<kPhoneTable>;
+
+}  // namespace state_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STATE_PATTERN_PHONE_HPP
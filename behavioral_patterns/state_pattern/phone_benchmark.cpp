@@ -0,0 +1,66 @@
+/**
+ * Firing random triggers at the phone: the constexpr dense table against the unordered_map of
+ * (trigger, state) vectors that handmade_state_machine.cpp builds. Unaccepted triggers leave the state unchanged.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "phone.hpp"
+
+namespace {
+
+using namespace behavioral::state_pattern;
+
+std::vector<Trigger> RandomTriggers(size_t count) {
+  std::mt19937 random{42};
+  std::uniform_int_distribution<int> trigger{0, static_cast<int>(kPhoneTriggers) - 1};
+  std::vector<Trigger> triggers(count);
+  for (auto& t : triggers) t = static_cast<Trigger>(trigger(random));
+  return triggers;
+}
+
+void BM_MapTransitions(benchmark::State& state) {
+  std::unordered_map<State, std::vector<std::pair<Trigger, State>>> rules;
+  for (auto& rule : kPhoneRules) rules[rule.from].emplace_back(rule.trigger, rule.to);
+  rules[State::on_hook];
+  auto triggers = RandomTriggers(1 << 20);
+
+  for (auto _ : state) {
+    State current{State::off_hook};
+    for (auto trigger : triggers) {
+      for (auto& [t, next] : rules.find(current)->second) {
+        if (t == trigger) {
+          current = next;
+          break;
+        }
+      }
+      if (current == State::on_hook) current = State::off_hook;
+    }
+    benchmark::DoNotOptimize(current);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(triggers.size()));
+}
+
+void BM_TableTransitions(benchmark::State& state) {
+  auto triggers = RandomTriggers(1 << 20);
+
+  for (auto _ : state) {
+    Phone phone{State::off_hook};
+    for (auto trigger : triggers) {
+      phone.Fire(trigger);
+      if (phone.CurrentState() == State::on_hook) phone = Phone{State::off_hook};
+    }
+    benchmark::DoNotOptimize(phone);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(triggers.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_MapTransitions);
+BENCHMARK(BM_TableTransitions);
@@ -21,75 +21,20 @@
  *  - Guard conditions enabling/disabling are found for an event
  *  - Default action when no transitions are found for an event
  */
-#include <iostream>
+#include <sstream>
 
-namespace behavioral {
-namespace state_pattern {
+#include "light_switch.hpp"
 
 /**
  * The traditional approach to the state pattern is not very good.
  * The idea that you have every individual states allowing functions to be called on it,
  * to switch to a completely different state. But the implementation of this function has to
  * end with a 'delete this' which might result in undefined behavior.
+ *
+ * light_switch.hpp avoids both the 'delete this' and the allocation per transition by making the states flyweights:
+ * one shared, stateless instance per state.
  */
 
-class LightSwitch;
-
-struct State {
-  virtual void On(LightSwitch* ls) {
-    std::cout << "Light is already on.\n";
-    auto ls_ = ls;  // unused parameter warning
-    (void)ls_;
-  }
-
-  virtual void Off(LightSwitch* ls) {
-    std::cout << "Light is already off.\n";
-    auto ls_ = ls;  // unused parameter warning
-    (void)ls_;
-  }
-};
-
-struct OnState : public State {
-  OnState() { std::cout << "Light is turned on!\n"; }
-
-  void Off(LightSwitch* ls) override;
-};
-
-struct OffState : public State {
-  OffState() { std::cout << "Light is switched off!\n"; }
-
-  void On(LightSwitch* ls) override;
-};
-
-class LightSwitch {
- public:
-  LightSwitch() { state_ = new OffState(); }
-
-  void SetState(State* state) { this->state_ = state; }
-
-  void On() { state_->On(this); }
-
-  void Off() { state_->Off(this); }
-
- private:
-  State* state_;
-};
-
-void OnState::Off(LightSwitch* ls) {
-  std::cout << "Switching light off..." << std::endl;
-  ls->SetState(new OffState());
-  // delete this;
-}
-
-void OffState::On(LightSwitch* ls) {
-  std::cout << "Switching light on..." << std::endl;
-  ls->SetState(new OnState());
-  // delete this;
-}
-
-}  // namespace state_pattern
-}  // namespace behavioral
-
 // TEST---------------------------------------------------------------------------------------------------------------|
 
 #include "gtest/gtest.h"
@@ -105,4 +50,22 @@ TEST(StatePatternTest, UsageOfTheStatePattern) {
   ls.Off();
 }
 
+TEST(StatePatternTest, StatesAreSharedFlyweights) {
+  std::ostringstream log;
+  LightSwitch first{log}, second{log};
+  first.On();
+  second.On();
+  ASSERT_TRUE(first.IsOn());
+  first.On();
+  first.Off();
+  ASSERT_FALSE(first.IsOn());
+  ASSERT_TRUE(second.IsOn());
+
+  ASSERT_EQ(
+      "Light is switched off!\nLight is switched off!\n"
+      "Switching light on...\nLight is turned on!\nSwitching light on...\nLight is turned on!\n"
+      "Light is already on.\nSwitching light off...\nLight is switched off!\n",
+      log.str());
+}
+
 }  // namespace
@@ -0,0 +1,121 @@
+#ifndef BEHAVIORAL_PATTERNS_STATE_PATTERN_TRANSITION_TABLE_HPP
+#define BEHAVIORAL_PATTERNS_STATE_PATTERN_TRANSITION_TABLE_HPP
+
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace behavioral {
+namespace state_pattern {
+
+template <typename State, typename Trigger>
+struct Rule {
+  State from;
+  Trigger trigger;
+  State to;
+};
+
+/**
+ * Dense [State][Trigger] transition table, built from a list of rules at compile time:
+ *
+ *   constexpr Rule<State, Trigger> kRules[] = {{State::a, Trigger::go, State::b}, ...};
+ *   constexpr TransitionTable<State, Trigger, 2, 1> kTable{kRules};
+ *
+ * States and triggers are enums numbered 0..StateCount-1 and 0..TriggerCount-1. A rule with an out-of-range value
+ * or a second rule for the same state and trigger throws, which turns into a compile error when the table is
+ * constexpr. Reachable() and DeadEnds() let a static_assert reject state graphs with unreachable or inescapable
+ * states. Looking up a transition is a single indexed load.
+ */
+template <typename State, typename Trigger, size_t StateCount, size_t TriggerCount>
+class TransitionTable {
+ public:
+  using StateType = State;
+  using TriggerType = Trigger;
+
+  static constexpr size_t kStates = StateCount;
+  static constexpr size_t kTriggers = TriggerCount;
+  static constexpr State kNone = static_cast<State>(StateCount);  // marks a trigger the state does not accept
+
+  template <size_t N>
+  constexpr explicit TransitionTable(const Rule<State, Trigger> (&rules)[N]) : next_{} {
+    for (auto& row : next_)
+      for (auto& cell : row) cell = kNone;
+    for (auto& rule : rules) {
+      if (Index(rule.from) >= StateCount || Index(rule.to) >= StateCount || Index(rule.trigger) >= TriggerCount)
+        throw std::out_of_range("Rule refers to an unknown state or trigger");
+      auto& cell = next_[Index(rule.from)][Index(rule.trigger)];
+      if (cell != kNone) throw std::logic_error("Two rules for the same state and trigger");
+      cell = rule.to;
+    }
+  }
+
+  // The state `trigger` leads to from `state`, or kNone.
+  constexpr State Next(State state, Trigger trigger) const { return next_[Index(state)][Index(trigger)]; }
+
+  // Whether every state can be reached from `initial`.
+  constexpr bool Reachable(State initial) const {
+    std::array<bool, StateCount> reached{};
+    reached[Index(initial)] = true;
+    for (size_t round = 0; round < StateCount; ++round)
+      for (size_t from = 0; from < StateCount; ++from)
+        if (reached[from])
+          for (auto to : next_[from])
+            if (to != kNone) reached[Index(to)] = true;
+    for (auto r : reached)
+      if (!r) return false;
+    return true;
+  }
+
+  // Number of states other than `terminal` that accept no trigger at all.
+  constexpr size_t DeadEnds(State terminal) const {
+    size_t dead{0};
+    for (size_t from = 0; from < StateCount; ++from) {
+      if (from == Index(terminal)) continue;
+      bool accepts{false};
+      for (auto to : next_[from]) accepts = accepts || to != kNone;
+      if (!accepts) ++dead;
+    }
+    return dead;
+  }
+
+ private:
+  template <typename E>
+  static constexpr size_t Index(E value) {
+    return static_cast<size_t>(value);
+  }
+
+  std::array<std::array<State, TriggerCount>, StateCount> next_;
+};
+
+/**
+ * A machine over a constexpr TransitionTable; the table is a template argument, so it is not stored per machine
+ * and the compiler sees its address as a constant.
+ */
+template <const auto& kTable>
+class StateMachine {
+ public:
+  using Table = std::remove_cv_t<std::remove_reference_t<decltype(kTable)>>;
+  using State = typename Table::StateType;
+  using Trigger = typename Table::TriggerType;
+
+  constexpr explicit StateMachine(State initial) : state_(initial) {}
+
+  constexpr State CurrentState() const { return state_; }
+
+  // Moves to the next state; triggers the current state does not accept are ignored and return false.
+  constexpr bool Fire(Trigger trigger) {
+    auto next = kTable.Next(state_, trigger);
+    if (next == kTable.kNone) return false;
+    state_ = next;
+    return true;
+  }
+
+ private:
+  State state_;
+};
+
+}  // namespace state_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STATE_PATTERN_TRANSITION_TABLE_HPP
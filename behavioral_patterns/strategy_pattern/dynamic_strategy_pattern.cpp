@@ -18,81 +18,13 @@
  *  - Provide for either dynamic or static composition of strategy in the overall algorithm
  */
 #include <iostream>
-#include <memory>
-#include <sstream>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
-namespace behavioral {
-namespace strategy_pattern {
-
-enum class OutpuFormat {
-  markdown,
-  // * item1
-  // * item2
-
-  html
-  // <ul>
-  //  <li>item1</li>
-  // </ul>
-};
-
-struct ListStrategy {
-  virtual ~ListStrategy() = default;
-  virtual void Start(std::ostringstream& oss) { oss << ""; }
-  virtual void End(std::ostringstream& oss) { oss << ""; }
-  virtual void AddListItem(std::ostringstream& oss, const std::string& item) = 0;
-};
-
-struct MarkdownStrategy : public ListStrategy {
-  void AddListItem(std::ostringstream& oss, const std::string& item) override { oss << " * " << item << "\n"; }
-};
-
-struct HtmlStrategy : public ListStrategy {
-  void Start(std::ostringstream& oss) override { oss << "<ul>\n"; }
-
-  void AddListItem(std::ostringstream& oss, const std::string& item) override {
-    oss << "  <li>" << item << "</li>" << std::endl;
-  }
-
-  void End(std::ostringstream& oss) override { oss << "</ul>\n"; }
-};
-
-struct TextProcessor {
- public:
-  void Clear() {
-    oss_.str("");
-    oss_.clear();
-  }
-
-  void AppendList(const std::vector<std::string>& items) {
-    list_strategy_->Start(oss_);
-    for (auto& item : items) {
-      list_strategy_->AddListItem(oss_, item);
-    }
-    list_strategy_->End(oss_);
-  }
-
-  void SetOutputFormat(const OutpuFormat& format) {
-    switch (format) {
-      case OutpuFormat::markdown:
-        list_strategy_ = std::make_unique<MarkdownStrategy>();
-        break;
-      case OutpuFormat::html:
-        list_strategy_ = std::make_unique<HtmlStrategy>();
-        break;
-    }
-  }
-
-  std::string str() const { return oss_.str(); }
-
- private:
-  std::ostringstream oss_;
-  std::unique_ptr<ListStrategy> list_strategy_;
-};
-
-}  // namespace strategy_pattern
-}  // namespace behavioral
+#include "text_processor.hpp"
 
 // TEST---------------------------------------------------------------------------------------------------------------|
 
@@ -117,4 +49,88 @@ TEST(StrategyPatternTest, UsageOfTheStrategyPattern) {
   std::cout << tp.str() << std::endl;
 }
 
+TEST(StrategyPatternTest, ListsAreRenderedIntoOneReservedBuffer) {
+  std::vector<std::string> items{"foo", "bar", "baz"};
+
+  TextProcessor tp;
+  tp.SetOutputFormat(OutpuFormat::html);
+  tp.AppendList(items);
+  ASSERT_EQ("<ul>\n  <li>foo</li>\n  <li>bar</li>\n  <li>baz</li>\n</ul>\n", tp.view());
+
+  tp.Clear();
+  tp.SetOutputFormat(OutpuFormat::markdown);
+  tp.AppendList(items);
+  ASSERT_EQ(" * foo\n * bar\n * baz\n", tp.view());
+
+  OutputBuffer buffer;
+  MarkdownStrategy markdown;
+  buffer.Reserve(RenderedSize(markdown, items));
+  for (auto& item : items) markdown.AddListItem(buffer, item);
+  ASSERT_EQ(buffer.size(), buffer.capacity());  // the estimate is exact
+}
+
+TEST(StrategyPatternTest, MovedFromBuffersCanBeReused) {
+  OutputBuffer buffer;
+  buffer.Append("foo");
+  OutputBuffer moved{std::move(buffer)};
+  ASSERT_EQ("foo", moved.view());
+  ASSERT_EQ(0u, buffer.capacity());
+  buffer.Clear();
+  buffer.Append("x");
+  ASSERT_EQ("x", buffer.view());
+
+  OutputBuffer assigned;
+  assigned = std::move(buffer);
+  buffer.Append("bar", "baz");
+  ASSERT_EQ("barbaz", buffer.view());
+  ASSERT_EQ("x", assigned.view());
+
+  std::vector<std::string> items{"foo"};
+  TextProcessor tp;
+  tp.SetOutputFormat(OutpuFormat::html);
+  tp.AppendList(items);
+  TextProcessor other{std::move(tp)};
+  tp.Clear();
+  tp.SetOutputFormat(OutpuFormat::html);  // the strategy moved along with the output
+  tp.AppendList(items);
+  ASSERT_EQ(other.view(), tp.view());
+}
+
+TEST(StrategyPatternTest, ParallelRenderingKeepsItemOrder) {
+  std::vector<std::string> items;
+  for (int i = 0; i < 100000; ++i) items.push_back(std::to_string(i));
+
+  for (auto format : {OutpuFormat::markdown, OutpuFormat::html}) {
+    TextProcessor sequential;
+    sequential.SetOutputFormat(format);
+    sequential.AppendList(items);
+
+    for (size_t threads : {1u, 3u, 8u, 64u}) {
+      TextProcessor parallel;
+      parallel.SetOutputFormat(format);
+      parallel.AppendList(items, threads);
+      ASSERT_EQ(sequential.view(), parallel.view()) << threads << " threads";
+    }
+  }
+
+  TextProcessor empty;
+  empty.SetOutputFormat(OutpuFormat::html);
+  empty.AppendList({}, 4);
+  ASSERT_EQ("<ul>\n</ul>\n", empty.view());
+}
+
+TEST(StrategyPatternTest, ParallelRenderingPassesOnExceptions) {
+  struct FailingStrategy : MarkdownStrategy {
+    void AddListItem(OutputBuffer& out, std::string_view item) override {
+      if (item == "99999") throw std::runtime_error("Cannot render " + std::string{item});
+      MarkdownStrategy::AddListItem(out, item);
+    }
+  };
+
+  std::vector<std::string> items;
+  for (int i = 0; i < 100000; ++i) items.push_back(std::to_string(i));
+  FailingStrategy strategy;
+  ASSERT_THROW(RenderChunks(strategy, items, 8), std::runtime_error);  // thrown by the last chunk's thread
+}
+
 }  // namespace
@@ -0,0 +1,77 @@
+#ifndef BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_OUTPUT_BUFFER_HPP
+#define BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_OUTPUT_BUFFER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace behavioral {
+namespace strategy_pattern {
+
+/**
+ * Append-only character buffer for rendering text, without the locale, formatting state and virtual calls of an
+ * std::ostringstream. Reserve() the expected size up front and every Append() is a bounds check and a memcpy; when
+ * an estimate falls short the buffer doubles, like std::string, but the new bytes are never zero-filled.
+ */
+class OutputBuffer {
+ public:
+  OutputBuffer() = default;
+  // A moved-from buffer is empty and has no capacity, so it can be reused.
+  OutputBuffer(OutputBuffer&& other) noexcept
+      : data_(std::move(other.data_)),
+        size_(std::exchange(other.size_, 0)),
+        capacity_(std::exchange(other.capacity_, 0)) {}
+  OutputBuffer& operator=(OutputBuffer&& other) noexcept {
+    data_ = std::move(other.data_);
+    size_ = std::exchange(other.size_, 0);
+    capacity_ = std::exchange(other.capacity_, 0);
+    return *this;
+  }
+
+  void Reserve(size_t capacity) {
+    if (capacity > capacity_) Reallocate(capacity);
+  }
+
+  // Appends all pieces, checking for room once.
+  template <typename... Pieces>
+  void Append(const Pieces&... pieces) {
+    auto n = (std::string_view{pieces}.size() + ...);
+    if (n == 0) return;
+    if (size_ + n > capacity_) Reallocate(std::max(size_ + n, 2 * capacity_));
+    (Copy(std::string_view{pieces}), ...);
+  }
+
+  void Clear() { size_ = 0; }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  const char* data() const { return data_.get(); }
+  std::string_view view() const { return {data_.get(), size_}; }
+  std::string str() const { return std::string{view()}; }
+
+ private:
+  void Reallocate(size_t capacity) {
+    std::unique_ptr<char[]> data{new char[capacity]};
+    if (size_ > 0) std::memcpy(data.get(), data_.get(), size_);
+    data_ = std::move(data);
+    capacity_ = capacity;
+  }
+
+  void Copy(std::string_view piece) {
+    std::memcpy(data_.get() + size_, piece.data(), piece.size());
+    size_ += piece.size();
+  }
+
+  std::unique_ptr<char[]> data_;
+  size_t size_{0};
+  size_t capacity_{0};
+};
+
+}  // namespace strategy_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_OUTPUT_BUFFER_HPP
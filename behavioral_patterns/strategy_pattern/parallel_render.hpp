@@ -0,0 +1,59 @@
+#ifndef BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_PARALLEL_RENDER_HPP
+#define BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_PARALLEL_RENDER_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <vector>
+
+#include "behavioral_patterns/common/joining_threads.hpp"
+#include "output_buffer.hpp"
+
+namespace behavioral {
+namespace strategy_pattern {
+
+/**
+ * Renders the items of a list, without its start and end, as consecutive chunks on up to `threads` threads; the
+ * calling thread renders the first chunk. Each chunk goes into its own buffer reserved to its exact size, so the
+ * threads never share a cache line, and the chunks hold the items in order: append them one after the other, or
+ * hand them to a gather write (writev) as they are. The strategy is shared by all threads, so AddListItem must not
+ * modify it. If AddListItem throws, the exception is rethrown here once every thread has stopped.
+ */
+template <typename Strategy>
+std::vector<OutputBuffer> RenderChunks(Strategy& strategy, const std::vector<std::string>& items, size_t threads) {
+  constexpr size_t kMinItemsPerChunk = 4096;  // below this, starting a thread costs more than it saves
+  auto chunks = std::max<size_t>(1, std::min(threads, items.size() / kMinItemsPerChunk));
+  auto per_chunk = (items.size() + chunks - 1) / chunks;
+
+  std::vector<OutputBuffer> rendered(chunks);
+  std::vector<std::exception_ptr> errors(chunks);
+  auto render = [&strategy, &items, &rendered, &errors, per_chunk](size_t chunk) {
+    try {
+      auto begin = items.begin() + static_cast<std::ptrdiff_t>(std::min(items.size(), chunk * per_chunk));
+      auto end = items.begin() + static_cast<std::ptrdiff_t>(std::min(items.size(), (chunk + 1) * per_chunk));
+      auto bytes = static_cast<size_t>(end - begin) * strategy.ItemOverhead();
+      for (auto item = begin; item != end; ++item) bytes += item->size();
+
+      auto& out = rendered[chunk];
+      out.Reserve(bytes);
+      for (auto item = begin; item != end; ++item) strategy.AddListItem(out, *item);
+    } catch (...) {
+      errors[chunk] = std::current_exception();
+    }
+  };
+
+  {
+    common::JoiningThreads pool{chunks - 1};
+    for (size_t chunk = 1; chunk < chunks; ++chunk) pool.Start(render, chunk);
+    render(0);
+  }
+  for (auto& error : errors)
+    if (error) std::rethrow_exception(error);
+  return rendered;
+}
+
+}  // namespace strategy_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_PARALLEL_RENDER_HPP
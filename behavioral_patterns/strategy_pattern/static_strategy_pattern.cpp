@@ -1,69 +1,10 @@
+#include <cstddef>
 #include <iostream>
-#include <memory>
-#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
-namespace behavioral {
-namespace static_strategy_pattern {
-
-enum class OutpuFormat {
-  markdown,
-  // * item1
-  // * item2
-
-  html
-  // <ul>
-  //  <li>item1</li>
-  // </ul>
-};
-
-struct ListStrategy {
-  virtual ~ListStrategy() = default;
-  virtual void Start(std::ostringstream& oss) { oss << ""; }
-  virtual void End(std::ostringstream& oss) { oss << ""; }
-  virtual void AddListItem(std::ostringstream& oss, const std::string& item) = 0;
-};
-
-struct MarkdownStrategy : public ListStrategy {
-  void AddListItem(std::ostringstream& oss, const std::string& item) override { oss << " * " << item << "\n"; }
-};
-
-struct HtmlStrategy : public ListStrategy {
-  void Start(std::ostringstream& oss) override { oss << "<ul>\n"; }
-
-  void AddListItem(std::ostringstream& oss, const std::string& item) override {
-    oss << "  <li>" << item << "</li>" << std::endl;
-  }
-
-  void End(std::ostringstream& oss) override { oss << "</ul>\n"; }
-};
-
-template <typename LS>
-struct TextProcessor {
- public:
-  void Clear() {
-    oss_.str("");
-    oss_.clear();
-  }
-
-  void AppendList(const std::vector<std::string>& items) {
-    list_strategy_.Start(oss_);
-    for (auto& item : items) {
-      list_strategy_.AddListItem(oss_, item);
-    }
-    list_strategy_.End(oss_);
-  }
-
-  std::string str() const { return oss_.str(); }
-
- private:
-  std::ostringstream oss_;
-  LS list_strategy_;
-};
-
-}  // namespace static_strategy_pattern
-}  // namespace behavioral
+#include "static_text_processor.hpp"
 
 // TEST---------------------------------------------------------------------------------------------------------------|
 
@@ -85,4 +26,50 @@ TEST(StrategyPatternTest, UsageOfTheStrategyPattern) {
   std::cout << tp_html.str() << std::endl;
 }
 
+TEST(StrategyPatternTest, ListsAreRenderedIntoOneReservedBuffer) {
+  std::vector<std::string> items{"foo", "bar", "baz"};
+
+  TextProcessor<MarkdownStrategy> tp_md;
+  tp_md.AppendList(items);
+  ASSERT_EQ(" * foo\n * bar\n * baz\n", tp_md.view());
+
+  TextProcessor<HtmlStrategy> tp_html;
+  tp_html.AppendList(items);
+  tp_html.Clear();
+  tp_html.AppendList({"qux"});
+  ASSERT_EQ("<ul>\n  <li>qux</li>\n</ul>\n", tp_html.str());
+}
+
+TEST(StrategyPatternTest, MovedFromProcessorsCanBeReused) {
+  TextProcessor<HtmlStrategy> tp;
+  tp.AppendList({"foo"});
+  TextProcessor<HtmlStrategy> other{std::move(tp)};
+  tp.Clear();
+  tp.AppendList({"foo"});
+  ASSERT_EQ(other.view(), tp.view());
+}
+
+template <typename Strategy>
+void ExpectParallelMatchesSequential(const std::vector<std::string>& items) {
+  TextProcessor<Strategy> sequential;
+  sequential.AppendList(items);
+
+  for (size_t threads : {1u, 3u, 8u, 64u}) {
+    TextProcessor<Strategy> parallel;
+    parallel.AppendList(items, threads);
+    ASSERT_EQ(sequential.view(), parallel.view()) << threads << " threads";
+  }
+}
+
+TEST(StrategyPatternTest, ParallelRenderingKeepsItemOrder) {
+  std::vector<std::string> items;
+  for (int i = 0; i < 100000; ++i) items.push_back(std::to_string(i));
+  ExpectParallelMatchesSequential<MarkdownStrategy>(items);
+  ExpectParallelMatchesSequential<HtmlStrategy>(items);
+
+  TextProcessor<HtmlStrategy> empty;
+  empty.AppendList({}, 4);
+  ASSERT_EQ("<ul>\n</ul>\n", empty.view());
+}
+
 }  // namespace
@@ -0,0 +1,62 @@
+#ifndef BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_STATIC_TEXT_PROCESSOR_HPP
+#define BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_STATIC_TEXT_PROCESSOR_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "output_buffer.hpp"
+#include "parallel_render.hpp"
+#include "text_processor.hpp"
+
+namespace behavioral {
+namespace static_strategy_pattern {
+
+// The strategies are the dynamic example's; only how TextProcessor binds to one differs.
+using strategy_pattern::HtmlStrategy;
+using strategy_pattern::ListStrategy;
+using strategy_pattern::MarkdownStrategy;
+using strategy_pattern::OutpuFormat;
+using strategy_pattern::OutputBuffer;
+using strategy_pattern::RenderChunks;
+using strategy_pattern::RenderedSize;
+
+template <typename LS>
+struct TextProcessor {
+ public:
+  void Clear() { buffer_.Clear(); }
+
+  // Reserves the whole list up front, so rendering it never reallocates.
+  void AppendList(const std::vector<std::string>& items) {
+    buffer_.Reserve(buffer_.size() + RenderedSize(list_strategy_, items));
+    list_strategy_.Start(buffer_);
+    for (auto& item : items) {
+      list_strategy_.AddListItem(buffer_, item);
+    }
+    list_strategy_.End(buffer_);
+  }
+
+  // Same output as AppendList(items), with the items rendered in chunks on up to `threads` threads.
+  void AppendList(const std::vector<std::string>& items, size_t threads) {
+    auto chunks = RenderChunks(list_strategy_, items, threads);
+    auto bytes = list_strategy_.ListOverhead();
+    for (auto& chunk : chunks) bytes += chunk.size();
+    buffer_.Reserve(buffer_.size() + bytes);
+    list_strategy_.Start(buffer_);
+    for (auto& chunk : chunks) buffer_.Append(chunk.view());
+    list_strategy_.End(buffer_);
+  }
+
+  std::string str() const { return buffer_.str(); }
+  std::string_view view() const { return buffer_.view(); }
+
+ private:
+  OutputBuffer buffer_;
+  LS list_strategy_;
+};
+
+}  // namespace static_strategy_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_STATIC_TEXT_PROCESSOR_HPP
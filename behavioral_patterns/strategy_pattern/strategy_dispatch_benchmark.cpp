@@ -0,0 +1,138 @@
+/**
+ * Per-item cost of the ways a TextProcessor can call its list strategy: a virtual call through a unique_ptr
+ * (dynamic_strategy_pattern), a template parameter (static_strategy_pattern), std::visit on a std::variant of the
+ * strategies and a table of plain function pointers. Each renders a Markdown list into a buffer it reuses, so
+ * allocation does not hide the dispatch; arguments are the item count and the item length.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "output_buffer.hpp"
+#include "static_text_processor.hpp"
+#include "text_processor.hpp"
+
+namespace {
+
+using namespace behavioral;
+using strategy_pattern::OutputBuffer;
+using strategy_pattern::RenderedSize;
+
+std::vector<std::string> Items(size_t count, size_t length) {
+  std::vector<std::string> items(count);
+  for (size_t i = 0; i < count; ++i) items[i] = std::string(length, static_cast<char>('a' + i % 26));
+  return items;
+}
+
+// The other processors below mirror TextProcessor::AppendList step by step (reserve the rendered size, Start(),
+// every item, End()), so that only the way each step reaches the strategy differs.
+class VariantTextProcessor {
+ public:
+  using Strategy = std::variant<strategy_pattern::MarkdownStrategy, strategy_pattern::HtmlStrategy>;
+
+  explicit VariantTextProcessor(Strategy strategy) : strategy_(strategy) {}
+
+  void Clear() { buffer_.Clear(); }
+
+  void AppendList(const std::vector<std::string>& items) {
+    buffer_.Reserve(buffer_.size() + std::visit([&items](auto& s) { return RenderedSize(s, items); }, strategy_));
+    std::visit([this](auto& s) { s.Start(buffer_); }, strategy_);
+    for (auto& item : items) std::visit([this, &item](auto& s) { s.AddListItem(buffer_, item); }, strategy_);
+    std::visit([this](auto& s) { s.End(buffer_); }, strategy_);
+  }
+
+  std::string_view view() const { return buffer_.view(); }
+
+ private:
+  OutputBuffer buffer_;
+  Strategy strategy_;
+};
+
+// A strategy as a table of plain functions.
+struct ListFunctions {
+  size_t (*rendered_size)(const std::vector<std::string>&);
+  void (*start)(OutputBuffer&);
+  void (*add_list_item)(OutputBuffer&, std::string_view);
+  void (*end)(OutputBuffer&);
+};
+
+template <typename Strategy>
+constexpr ListFunctions kListFunctions{
+    [](const std::vector<std::string>& items) { return RenderedSize(Strategy{}, items); },
+    [](OutputBuffer& out) { Strategy{}.Start(out); },
+    [](OutputBuffer& out, std::string_view item) { Strategy{}.AddListItem(out, item); },
+    [](OutputBuffer& out) { Strategy{}.End(out); },
+};
+
+class FunctionPointerTextProcessor {
+ public:
+  explicit FunctionPointerTextProcessor(const ListFunctions& functions) : functions_(functions) {}
+
+  void Clear() { buffer_.Clear(); }
+
+  void AppendList(const std::vector<std::string>& items) {
+    buffer_.Reserve(buffer_.size() + functions_.rendered_size(items));
+    functions_.start(buffer_);
+    for (auto& item : items) functions_.add_list_item(buffer_, item);
+    functions_.end(buffer_);
+  }
+
+  std::string_view view() const { return buffer_.view(); }
+
+ private:
+  OutputBuffer buffer_;
+  ListFunctions functions_;
+};
+
+template <typename Processor>
+void Render(benchmark::State& state, Processor& tp) {
+  auto items = Items(static_cast<size_t>(state.range(0)), static_cast<size_t>(state.range(1)));
+  for (auto _ : state) {
+    tp.Clear();
+    tp.AppendList(items);
+    benchmark::DoNotOptimize(tp.view().data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(items.size()));
+  // Seconds per item, printed with an SI prefix (e.g. 1.5n).
+  state.counters["per_item"] = benchmark::Counter(static_cast<double>(items.size()),
+                                                  benchmark::Counter::kIsIterationInvariantRate |
+                                                      benchmark::Counter::kInvert);
+}
+
+void BM_Virtual(benchmark::State& state) {
+  strategy_pattern::TextProcessor tp;
+  tp.SetOutputFormat(strategy_pattern::OutpuFormat::markdown);
+  Render(state, tp);
+}
+
+void BM_Template(benchmark::State& state) {
+  static_strategy_pattern::TextProcessor<static_strategy_pattern::MarkdownStrategy> tp;
+  Render(state, tp);
+}
+
+void BM_Variant(benchmark::State& state) {
+  VariantTextProcessor tp{strategy_pattern::MarkdownStrategy{}};
+  Render(state, tp);
+}
+
+void BM_FunctionPointer(benchmark::State& state) {
+  FunctionPointerTextProcessor tp{kListFunctions<strategy_pattern::MarkdownStrategy>};
+  Render(state, tp);
+}
+
+void Sizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"items", "length"});
+  for (int64_t count : {1 << 10, 1 << 16, 1 << 20})
+    for (int64_t length : {4, 32, 256}) benchmark->Args({count, length});
+}
+
+}  // namespace
+
+BENCHMARK(BM_Virtual)->Apply(Sizes);
+BENCHMARK(BM_Template)->Apply(Sizes);
+BENCHMARK(BM_Variant)->Apply(Sizes);
+BENCHMARK(BM_FunctionPointer)->Apply(Sizes);
@@ -0,0 +1,118 @@
+#ifndef BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_TEXT_PROCESSOR_HPP
+#define BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_TEXT_PROCESSOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "output_buffer.hpp"
+#include "parallel_render.hpp"
+
+namespace behavioral {
+namespace strategy_pattern {
+
+enum class OutpuFormat {
+  markdown,
+  // * item1
+  // * item2
+
+  html
+  // <ul>
+  //  <li>item1</li>
+  // </ul>
+};
+
+struct ListStrategy {
+  virtual ~ListStrategy() = default;
+  virtual void Start(OutputBuffer&) {}
+  virtual void End(OutputBuffer&) {}
+  virtual void AddListItem(OutputBuffer& out, std::string_view item) = 0;
+
+  // Bytes written around each item, and by Start() and End() together; lets a list be sized before rendering it.
+  virtual size_t ItemOverhead() const = 0;
+  virtual size_t ListOverhead() const { return 0; }
+};
+
+struct MarkdownStrategy : public ListStrategy {
+  static constexpr std::string_view kPrefix{" * "};
+  static constexpr std::string_view kSuffix{"\n"};
+
+  void AddListItem(OutputBuffer& out, std::string_view item) override { out.Append(kPrefix, item, kSuffix); }
+
+  size_t ItemOverhead() const override { return kPrefix.size() + kSuffix.size(); }
+};
+
+struct HtmlStrategy : public ListStrategy {
+  static constexpr std::string_view kStart{"<ul>\n"};
+  static constexpr std::string_view kPrefix{"  <li>"};
+  static constexpr std::string_view kSuffix{"</li>\n"};
+  static constexpr std::string_view kEnd{"</ul>\n"};
+
+  void Start(OutputBuffer& out) override { out.Append(kStart); }
+
+  void AddListItem(OutputBuffer& out, std::string_view item) override { out.Append(kPrefix, item, kSuffix); }
+
+  void End(OutputBuffer& out) override { out.Append(kEnd); }
+
+  size_t ItemOverhead() const override { return kPrefix.size() + kSuffix.size(); }
+  size_t ListOverhead() const override { return kStart.size() + kEnd.size(); }
+};
+
+// Exact size of `items` rendered with `strategy`.
+template <typename Strategy>
+size_t RenderedSize(const Strategy& strategy, const std::vector<std::string>& items) {
+  auto bytes = strategy.ListOverhead() + items.size() * strategy.ItemOverhead();
+  for (auto& item : items) bytes += item.size();
+  return bytes;
+}
+
+struct TextProcessor {
+ public:
+  void Clear() { buffer_.Clear(); }
+
+  // Reserves the whole list up front, so rendering it never reallocates.
+  void AppendList(const std::vector<std::string>& items) {
+    buffer_.Reserve(buffer_.size() + RenderedSize(*list_strategy_, items));
+    list_strategy_->Start(buffer_);
+    for (auto& item : items) {
+      list_strategy_->AddListItem(buffer_, item);
+    }
+    list_strategy_->End(buffer_);
+  }
+
+  void SetOutputFormat(const OutpuFormat& format) {
+    switch (format) {
+      case OutpuFormat::markdown:
+        list_strategy_ = std::make_unique<MarkdownStrategy>();
+        break;
+      case OutpuFormat::html:
+        list_strategy_ = std::make_unique<HtmlStrategy>();
+        break;
+    }
+  }
+
+  // Same output as AppendList(items), with the items rendered in chunks on up to `threads` threads.
+  void AppendList(const std::vector<std::string>& items, size_t threads) {
+    auto chunks = RenderChunks(*list_strategy_, items, threads);
+    auto bytes = list_strategy_->ListOverhead();
+    for (auto& chunk : chunks) bytes += chunk.size();
+    buffer_.Reserve(buffer_.size() + bytes);
+    list_strategy_->Start(buffer_);
+    for (auto& chunk : chunks) buffer_.Append(chunk.view());
+    list_strategy_->End(buffer_);
+  }
+
+  std::string str() const { return buffer_.str(); }
+  std::string_view view() const { return buffer_.view(); }
+
+ private:
+  OutputBuffer buffer_;
+  std::unique_ptr<ListStrategy> list_strategy_;
+};
+
+}  // namespace strategy_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_STRATEGY_PATTERN_TEXT_PROCESSOR_HPP
@@ -0,0 +1,105 @@
+/**
+ * Rendering a list of 1M items as HTML, in MB/s of output: the std::ostringstream strategies TextProcessor used to
+ * write through (HtmlStrategy flushed with std::endl on every item), against the reserved OutputBuffer with the
+ * strategy picked at run time and at compile time.
+ * BM_Parallel renders 10M items with AppendList(items, threads); 1 thread is the sequential AppendList(items).
+ */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "static_text_processor.hpp"
+#include "text_processor.hpp"
+
+namespace {
+
+using namespace behavioral;
+
+std::vector<std::string> Items(size_t count, size_t length) {
+  std::vector<std::string> items(count);
+  for (size_t i = 0; i < count; ++i) items[i] = std::string(length, static_cast<char>('a' + i % 26));
+  return items;
+}
+
+struct StreamStrategy {
+  virtual ~StreamStrategy() = default;
+  virtual void Start(std::ostringstream& oss) { oss << ""; }
+  virtual void End(std::ostringstream& oss) { oss << ""; }
+  virtual void AddListItem(std::ostringstream& oss, const std::string& item) = 0;
+};
+
+struct StreamHtmlStrategy : public StreamStrategy {
+  void Start(std::ostringstream& oss) override { oss << "<ul>\n"; }
+  void AddListItem(std::ostringstream& oss, const std::string& item) override {
+    oss << "  <li>" << item << "</li>" << std::endl;
+  }
+  void End(std::ostringstream& oss) override { oss << "</ul>\n"; }
+};
+
+void BM_Stream(benchmark::State& state) {
+  auto items = Items(1 << 20, static_cast<size_t>(state.range(0)));
+  std::unique_ptr<StreamStrategy> strategy = std::make_unique<StreamHtmlStrategy>();
+  size_t bytes{0};
+  for (auto _ : state) {
+    std::ostringstream oss;
+    strategy->Start(oss);
+    for (auto& item : items) strategy->AddListItem(oss, item);
+    strategy->End(oss);
+    bytes = oss.str().size();
+    benchmark::DoNotOptimize(bytes);
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+}
+
+void BM_DynamicBuffer(benchmark::State& state) {
+  auto items = Items(1 << 20, static_cast<size_t>(state.range(0)));
+  size_t bytes{0};
+  for (auto _ : state) {
+    strategy_pattern::TextProcessor tp;
+    tp.SetOutputFormat(strategy_pattern::OutpuFormat::html);
+    tp.AppendList(items);
+    bytes = tp.view().size();
+    benchmark::DoNotOptimize(tp.view().data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+}
+
+void BM_StaticBuffer(benchmark::State& state) {
+  auto items = Items(1 << 20, static_cast<size_t>(state.range(0)));
+  size_t bytes{0};
+  for (auto _ : state) {
+    static_strategy_pattern::TextProcessor<static_strategy_pattern::HtmlStrategy> tp;
+    tp.AppendList(items);
+    bytes = tp.view().size();
+    benchmark::DoNotOptimize(tp.view().data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+}
+
+void BM_Parallel(benchmark::State& state) {
+  auto items = Items(10'000'000, 16);
+  auto threads = static_cast<size_t>(state.range(0));
+  size_t bytes{0};
+  for (auto _ : state) {
+    strategy_pattern::TextProcessor tp;
+    tp.SetOutputFormat(strategy_pattern::OutpuFormat::html);
+    if (threads == 1)
+      tp.AppendList(items);
+    else
+      tp.AppendList(items, threads);
+    bytes = tp.view().size();
+    benchmark::DoNotOptimize(tp.view().data());
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes));
+}
+
+}  // namespace
+
+BENCHMARK(BM_Stream)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DynamicBuffer)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_StaticBuffer)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Parallel)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
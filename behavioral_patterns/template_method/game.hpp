@@ -0,0 +1,179 @@
+#ifndef BEHAVIORAL_PATTERNS_TEMPLATE_METHOD_GAME_HPP
+#define BEHAVIORAL_PATTERNS_TEMPLATE_METHOD_GAME_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "behavioral_patterns/common/joining_threads.hpp"
+
+namespace behavioral {
+namespace template_method {
+
+/**
+ * The Game skeleton with its steps bound at compile time (curiously recurring template pattern): Run() calls
+ * Derived::Start(), HaveWinner(), TakeTurn() and GetWinner() directly, so they can be inlined into the loop instead of
+ * costing four virtual calls per turn. Games only write to the log given at construction; without one they are
+ * silent, which is what simulating millions of them needs.
+ */
+template <typename Derived>
+class StaticGame {
+ public:
+  explicit StaticGame(int number_of_players, std::ostream* log = nullptr)
+      : number_of_players_(number_of_players), log_(log) {}
+
+  // Plays the game to the end; returns the winner.
+  int Run() {
+    auto& game = static_cast<Derived&>(*this);
+    game.Start();
+    while (!game.HaveWinner()) {
+      game.TakeTurn();
+    }
+    auto winner = game.GetWinner();
+    Log("Player ", winner, " wins.\n");
+    return winner;
+  }
+
+ protected:
+  // Arguments are taken by value and written out of line, so a silent game pays one branch per call and the
+  // values logged can stay in registers.
+  template <typename... Args>
+  void Log(Args... args) {
+    if (log_) Write(*log_, args...);
+  }
+
+  int number_of_players_;
+  int current_player_{0};
+
+ private:
+  template <typename... Args>
+  __attribute__((noinline, cold)) static void Write(std::ostream& log, Args... args) {
+    (log << ... << args);
+  }
+
+  std::ostream* log_;
+};
+
+// Small, fast generator (SplitMix64) for games that are created by the million; std::mt19937 is 5 KB of state.
+class GameRandom {
+ public:
+  explicit GameRandom(uint64_t seed) : state_(seed) {}
+
+  uint64_t Next() {
+    auto z = (state_ += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+  }
+
+  // Uniform in [1, sides].
+  int Roll(int sides) { return 1 + static_cast<int>(((Next() >> 32) * static_cast<uint64_t>(sides)) >> 32); }
+
+ private:
+  uint64_t state_;
+};
+
+/**
+ * Players take turns rolling a die and moving that many squares; the first to reach the finish wins. Moving first is
+ * an advantage, which is the kind of imbalance a Monte Carlo run is meant to measure.
+ */
+class DiceRace : public StaticGame<DiceRace> {
+ public:
+  DiceRace(int number_of_players, int finish, uint64_t seed, std::ostream* log = nullptr)
+      : StaticGame(number_of_players, log), random_(seed), finish_(finish) {
+    if (number_of_players < 1 || number_of_players > kMaxPlayers) throw std::invalid_argument("1 to 8 players");
+  }
+
+ private:
+  friend class StaticGame<DiceRace>;
+
+  static constexpr int kMaxPlayers = 8;
+
+  void Start() {
+    std::fill(position_, position_ + kMaxPlayers, 0);
+    winner_ = -1;
+    current_player_ = 0;
+    Log("Starting a dice race with ", number_of_players_, " players\n");
+  }
+
+  bool HaveWinner() const { return winner_ >= 0; }
+
+  void TakeTurn() {
+    auto roll = random_.Roll(6);
+    position_[current_player_] += roll;
+    Log("Player ", current_player_, " rolls ", roll, " and moves to ", position_[current_player_], "\n");
+    if (position_[current_player_] >= finish_)
+      winner_ = current_player_;
+    else
+      current_player_ = (current_player_ + 1) % number_of_players_;
+  }
+
+  int GetWinner() const { return winner_; }
+
+  GameRandom random_;
+  int finish_;
+  int position_[kMaxPlayers];
+  int winner_{-1};
+};
+
+struct WinStatistics {
+  std::vector<uint64_t> wins;  // per player
+  uint64_t games{0};
+
+  double Share(int player) const {
+    return static_cast<double>(wins.at(static_cast<size_t>(player))) / static_cast<double>(games);
+  }
+};
+
+/**
+ * Plays `games` independent games split over `threads` threads and counts each player's wins. make_game(i) builds
+ * game number i and should depend on i alone (e.g. seed its random numbers with it), so the statistics are the same
+ * for any number of threads. Each thread counts into its own table, merged once at the end. A winner outside
+ * [0, number_of_players) throws std::out_of_range, from whichever thread played that game.
+ */
+template <typename MakeGame>
+WinStatistics RunGames(uint64_t games, int number_of_players, size_t threads, MakeGame make_game) {
+  threads = std::max<size_t>(1, std::min<uint64_t>(threads, games / 1024 + 1));
+  auto per_thread = games / threads + 1;
+  std::vector<std::vector<uint64_t>> wins(threads, std::vector<uint64_t>(static_cast<size_t>(number_of_players)));
+
+  std::vector<std::exception_ptr> errors(threads);
+
+  auto play = [&make_game, &wins, &errors, games, per_thread](size_t thread) {
+    try {
+      std::vector<uint64_t> counts(wins[thread].size());  // not wins[thread]: neighbouring tables share cache lines
+      auto end = std::min(games, (thread + 1) * per_thread);
+      for (auto game = thread * per_thread; game < end; ++game) {
+        auto winner = make_game(game).Run();
+        if (winner < 0 || static_cast<size_t>(winner) >= counts.size())
+          throw std::out_of_range("Game " + std::to_string(game) + " has no winner among the players");
+        ++counts[static_cast<size_t>(winner)];
+      }
+      wins[thread] = counts;
+    } catch (...) {
+      errors[thread] = std::current_exception();
+    }
+  };
+  {
+    common::JoiningThreads pool{threads - 1};
+    for (size_t thread = 1; thread < threads; ++thread) pool.Start(play, thread);
+    play(0);
+  }
+  for (auto& error : errors)
+    if (error) std::rethrow_exception(error);
+
+  WinStatistics statistics{std::vector<uint64_t>(static_cast<size_t>(number_of_players)), games};
+  for (auto& counts : wins)
+    for (size_t player = 0; player < counts.size(); ++player) statistics.wins[player] += counts[player];
+  return statistics;
+}
+
+}  // namespace template_method
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_TEMPLATE_METHOD_GAME_HPP
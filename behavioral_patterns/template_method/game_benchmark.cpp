@@ -0,0 +1,92 @@
+/**
+ * Games per second of a 2-player dice race to square 100: the same rules behind the virtual Game skeleton of
+ * template_method.cpp and behind StaticGame, both silent, and RunGames spreading StaticGame over threads.
+ */
+#include <cstdint>
+
+#include "benchmark/benchmark.h"
+#include "game.hpp"
+
+namespace {
+
+using namespace behavioral::template_method;
+
+constexpr int kFinish = 100;
+
+class VirtualGame {
+ public:
+  explicit VirtualGame(int number_of_players) : number_of_players_(number_of_players) {}
+  virtual ~VirtualGame() = default;
+
+  int Run() {
+    Start();
+    while (!HaveWinner()) TakeTurn();
+    return GetWinner();
+  }
+
+ protected:
+  int number_of_players_;
+  int current_player_{0};
+  virtual void Start() = 0;
+  virtual bool HaveWinner() = 0;
+  virtual void TakeTurn() = 0;
+  virtual int GetWinner() = 0;
+};
+
+class VirtualDiceRace : public VirtualGame {
+ public:
+  explicit VirtualDiceRace(uint64_t seed) : VirtualGame(2), random_(seed) {}
+
+ protected:
+  void Start() override { position_[0] = position_[1] = 0; }
+  bool HaveWinner() override { return winner_ >= 0; }
+  void TakeTurn() override {
+    position_[current_player_] += random_.Roll(6);
+    if (position_[current_player_] >= kFinish)
+      winner_ = current_player_;
+    else
+      current_player_ = (current_player_ + 1) % number_of_players_;
+  }
+  int GetWinner() override { return winner_; }
+
+ private:
+  GameRandom random_;
+  int position_[2];
+  int winner_{-1};
+};
+
+void BM_Virtual(benchmark::State& state) {
+  uint64_t game{0};
+  for (auto _ : state) {
+    VirtualDiceRace race{game++};
+    VirtualGame* base = &race;
+    benchmark::DoNotOptimize(base);  // hides the dynamic type, so the steps stay virtual calls
+    benchmark::DoNotOptimize(base->Run());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Static(benchmark::State& state) {
+  uint64_t game{0};
+  for (auto _ : state) {
+    DiceRace race{2, kFinish, game++};
+    benchmark::DoNotOptimize(race.Run());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_RunGames(benchmark::State& state) {
+  const uint64_t games{1'000'000};
+  auto threads = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    auto statistics = RunGames(games, 2, threads, [](uint64_t game) { return DiceRace{2, kFinish, game}; });
+    benchmark::DoNotOptimize(statistics.wins.data());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(games));
+}
+
+}  // namespace
+
+BENCHMARK(BM_Virtual);
+BENCHMARK(BM_Static);
+BENCHMARK(BM_RunGames)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -66,6 +66,12 @@ class Chess : public Game {
 
 // TEST---------------------------------------------------------------------------------------------------------------|
 
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "game.hpp"
 #include "gtest/gtest.h"
 
 namespace {
@@ -77,4 +83,43 @@ TEST(TemplateMethodTest, UsageOfTheTemplateMethod) {
   chess.Run();
 }
 
+TEST(TemplateMethodTest, CompileTimeTemplateMethod) {
+  std::ostringstream log;
+  DiceRace logged{2, 10, 7, &log};
+  auto winner = logged.Run();
+  ASSERT_EQ(0u, log.str().find("Starting a dice race with 2 players\n"));
+  ASSERT_NE(std::string::npos, log.str().find("Player " + std::to_string(winner) + " wins.\n"));
+
+  DiceRace silent{2, 10, 7};
+  ASSERT_EQ(winner, silent.Run());  // same seed, same game
+}
+
+TEST(TemplateMethodTest, CompileTimeGameCanBeRunAgain) {
+  std::ostringstream log;
+  DiceRace race{2, 10, 7, &log};
+  race.Run();
+  log.str("");
+
+  auto winner = race.Run();  // a fresh game, continuing the random sequence
+  ASSERT_EQ(0u, log.str().find("Starting a dice race with 2 players\nPlayer 0 rolls "));
+  ASSERT_NE(std::string::npos, log.str().find("Player " + std::to_string(winner) + " wins.\n"));
+}
+
+TEST(TemplateMethodTest, MonteCarloRunner) {
+  auto make_game = [](uint64_t game) { return DiceRace{2, 20, game}; };
+  auto one_thread = RunGames(100000, 2, 1, make_game);
+  auto four_threads = RunGames(100000, 2, 4, make_game);
+  ASSERT_EQ(one_thread.wins, four_threads.wins);
+  ASSERT_EQ(100000u, four_threads.wins[0] + four_threads.wins[1]);
+  ASSERT_GT(four_threads.Share(0), 0.5);  // moving first pays
+}
+
+TEST(TemplateMethodTest, MonteCarloRunnerRejectsUnknownWinners) {
+  struct NoWinner {
+    int Run() { return -1; }
+  };
+  ASSERT_THROW(RunGames(5000, 2, 4, [](uint64_t) { return NoWinner{}; }), std::out_of_range);
+  ASSERT_THROW(RunGames(5000, 2, 4, [](uint64_t game) { return DiceRace{3, 20, game}; }), std::out_of_range);
+}
+
 }  // namespace
@@ -0,0 +1,170 @@
+#ifndef BEHAVIORAL_PATTERNS_VISITOR_PATTERN_FLAT_EXPRESSION_HPP
+#define BEHAVIORAL_PATTERNS_VISITOR_PATTERN_FLAT_EXPRESSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace behavioral {
+namespace visitor_pattern {
+
+/**
+ * The expressions of classic_visitor_pattern.cpp without a heap object, owning pointer or virtual Accept() per node.
+ * Nodes are std::variants stored by value in one vector and refer to their children by index:
+ *
+ *   FlatExpression e;
+ *   auto two = e.AddDouble(2);
+ *   auto root = e.AddAddition(e.AddDouble(1), e.AddSubtraction(two, e.AddDouble(3)));  // 1+(2-3)
+ *
+ * A node can only refer to nodes added before it, so children always precede their parents and a single forward
+ * pass over the vector visits every node after its children, without recursion. Visitors are plain function
+ * objects applied with std::visit.
+ */
+class FlatExpression {
+ public:
+  using Index = uint32_t;
+
+  struct DoubleNode {
+    double value;
+  };
+  struct AdditionNode {
+    Index left, right;
+  };
+  struct SubtractionNode {
+    Index left, right;
+  };
+  using Node = std::variant<DoubleNode, AdditionNode, SubtractionNode>;
+
+  Index AddDouble(double value) { return Add(DoubleNode{value}); }
+  Index AddAddition(Index left, Index right) { return Add(AdditionNode{Checked(left), Checked(right)}); }
+  Index AddSubtraction(Index left, Index right) { return Add(SubtractionNode{Checked(left), Checked(right)}); }
+
+  void Reserve(size_t nodes) { nodes_.reserve(nodes); }
+
+  size_t size() const { return nodes_.size(); }
+  const Node& operator[](Index node) const { return nodes_[node]; }
+  const std::vector<Node>& Nodes() const { return nodes_; }
+
+  // The node added last, which is the whole expression when it was built bottom-up.
+  Index Root() const {
+    if (nodes_.empty()) throw std::logic_error("Empty expression");
+    return static_cast<Index>(nodes_.size() - 1);
+  }
+
+  // A node chosen as the root of a subexpression, which must have been added.
+  Index Root(Index node) const {
+    if (node >= nodes_.size()) throw std::out_of_range("The root must be a node of the expression");
+    return node;
+  }
+
+ private:
+  Index Add(Node node) {
+    if (nodes_.size() > UINT32_MAX) throw std::length_error("Too many nodes");
+    nodes_.push_back(node);
+    return static_cast<Index>(nodes_.size() - 1);
+  }
+
+  Index Checked(Index child) const {
+    if (child >= nodes_.size()) throw std::out_of_range("A child must be added before its parent");
+    return child;
+  }
+
+  std::vector<Node> nodes_;
+};
+
+/**
+ * Computes every node's value in one forward pass, children first; the values are kept between calls so evaluating
+ * many expressions allocates once.
+ */
+class FlatExpressionEvaluator {
+ public:
+  double Evaluate(const FlatExpression& expression) { return Evaluate(expression, expression.Root()); }
+
+  double Evaluate(const FlatExpression& expression, FlatExpression::Index root) {
+    root = expression.Root(root);
+    values_.resize(static_cast<size_t>(root) + 1);
+    auto& nodes = expression.Nodes();
+    for (size_t i = 0; i <= root; ++i) values_[i] = std::visit(NodeValue{values_.data()}, nodes[i]);
+    return values_[root];
+  }
+
+ private:
+  struct NodeValue {
+    const double* values;
+
+    double operator()(const FlatExpression::DoubleNode& node) const { return node.value; }
+    double operator()(const FlatExpression::AdditionNode& node) const {
+      return values[node.left] + values[node.right];
+    }
+    double operator()(const FlatExpression::SubtractionNode& node) const {
+      return values[node.left] - values[node.right];
+    }
+  };
+
+  std::vector<double> values_;
+};
+
+/**
+ * Prints an expression exactly as ExpressionPrinter does, including its brackets around any operation whose right
+ * operand is a subtraction. Printing is in-order, so it walks down from the root with an explicit stack instead of
+ * recursing, and arbitrarily deep expressions print without exhausting the call stack.
+ */
+class FlatExpressionPrinter {
+ public:
+  void Print(const FlatExpression& expression) { Print(expression, expression.Root()); }
+
+  void Print(const FlatExpression& expression, FlatExpression::Index root) {
+    pending_.push_back({expression.Root(root), 0});
+    while (!pending_.empty()) {
+      auto task = pending_.back();
+      pending_.pop_back();
+      if (task.text != 0)
+        out_ += task.text;
+      else
+        std::visit(Expand{expression, *this}, expression[task.node]);
+    }
+  }
+
+  const std::string& str() const { return out_; }
+
+ private:
+  struct Task {
+    FlatExpression::Index node;
+    char text;  // written as is if set, otherwise `node` is printed
+  };
+
+  struct Expand {
+    const FlatExpression& expression;
+    FlatExpressionPrinter& printer;
+
+    void operator()(const FlatExpression::DoubleNode& node) const {
+      char digits[32];
+      auto n = std::snprintf(digits, sizeof digits, "%g", node.value);  // what operator<< prints by default
+      printer.out_.append(digits, static_cast<size_t>(n));
+    }
+    void operator()(const FlatExpression::AdditionNode& node) const { Binary(node.left, '+', node.right); }
+    void operator()(const FlatExpression::SubtractionNode& node) const { Binary(node.left, '-', node.right); }
+
+    // Pushed in reverse, as the stack pops the last task first.
+    void Binary(FlatExpression::Index left, char op, FlatExpression::Index right) const {
+      auto braces = std::holds_alternative<FlatExpression::SubtractionNode>(expression[right]);
+      if (braces) printer.pending_.push_back({0, ')'});
+      printer.pending_.push_back({right, 0});
+      printer.pending_.push_back({0, op});
+      printer.pending_.push_back({left, 0});
+      if (braces) printer.pending_.push_back({0, '('});
+    }
+  };
+
+  std::string out_;
+  std::vector<Task> pending_;
+};
+
+}  // namespace visitor_pattern
+}  // namespace behavioral
+
+#endif  // BEHAVIORAL_PATTERNS_VISITOR_PATTERN_FLAT_EXPRESSION_HPP
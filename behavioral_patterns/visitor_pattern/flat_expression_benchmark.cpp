@@ -0,0 +1,99 @@
+/**
+ * Evaluating and printing a balanced expression of 10M nodes (random additions and subtractions over 5M numbers):
+ * the classic visitor, a heap object per node visited through virtual Accept(), against FlatExpression, one vector of
+ * std::variant nodes evaluated in a single forward pass.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+
+#include "benchmark/benchmark.h"
+#include "expression.hpp"
+#include "flat_expression.hpp"
+
+namespace {
+
+using namespace behavioral::visitor_pattern;
+
+constexpr size_t kLeaves = 5'000'000;
+
+// Both builders draw the same random numbers in the same order, so they build the same expression.
+Expression* BuildClassic(size_t leaves, std::mt19937& random) {
+  if (leaves == 1) return new DoubleExpression{static_cast<double>(random() % 100)};
+  auto left = BuildClassic(leaves / 2, random);
+  auto right = BuildClassic(leaves - leaves / 2, random);
+  if (random() % 2) return new AdditionExpression{left, right};
+  return new SubtractionExpression{left, right};
+}
+
+FlatExpression::Index BuildFlat(FlatExpression& expression, size_t leaves, std::mt19937& random) {
+  if (leaves == 1) return expression.AddDouble(static_cast<double>(random() % 100));
+  auto left = BuildFlat(expression, leaves / 2, random);
+  auto right = BuildFlat(expression, leaves - leaves / 2, random);
+  if (random() % 2) return expression.AddAddition(left, right);
+  return expression.AddSubtraction(left, right);
+}
+
+Expression& Classic() {
+  static std::unique_ptr<Expression> expression{[]() {
+    std::mt19937 random{42};
+    return BuildClassic(kLeaves, random);
+  }()};
+  return *expression;
+}
+
+const FlatExpression& Flat() {
+  static FlatExpression expression{[]() {
+    std::mt19937 random{42};
+    FlatExpression e;
+    e.Reserve(2 * kLeaves);
+    BuildFlat(e, kLeaves, random);
+    return e;
+  }()};
+  return expression;
+}
+
+void BM_ClassicEvaluator(benchmark::State& state) {
+  auto& expression = Classic();
+  for (auto _ : state) {
+    ExpressionEvaluator evaluator;
+    expression.Accept(&evaluator);
+    benchmark::DoNotOptimize(evaluator.result_);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(2 * kLeaves - 1));
+}
+
+void BM_FlatEvaluator(benchmark::State& state) {
+  auto& expression = Flat();
+  FlatExpressionEvaluator evaluator;
+  for (auto _ : state) benchmark::DoNotOptimize(evaluator.Evaluate(expression));
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(expression.size()));
+}
+
+void BM_ClassicPrinter(benchmark::State& state) {
+  auto& expression = Classic();
+  for (auto _ : state) {
+    ExpressionPrinter printer;
+    expression.Accept(&printer);
+    benchmark::DoNotOptimize(printer.str().size());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(2 * kLeaves - 1));
+}
+
+void BM_FlatPrinter(benchmark::State& state) {
+  auto& expression = Flat();
+  for (auto _ : state) {
+    FlatExpressionPrinter printer;
+    printer.Print(expression);
+    benchmark::DoNotOptimize(printer.str().size());
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(expression.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_ClassicEvaluator)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FlatEvaluator)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ClassicPrinter)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FlatPrinter)->Unit(benchmark::kMillisecond);
@@ -1,8 +1,12 @@
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <variant>
 
+#include "expression.hpp"
+#include "flat_expression.hpp"
+
 namespace behavioral {
 namespace visitor_pattern {
 
@@ -32,20 +36,57 @@ TEST(VisitorPatternTest, UsageOfTheStandardLibraryVisitors) {
   std::visit(ap, house);
 }
 
-/*
 TEST(VisitorPatternTest, UsageOfALambdaInsideTheStdVisit) {
   std::variant<std::string, int> house;
   house = 123;
 
-  // AddressPrinter ap;
-  std::visit([](auto& arg) {
-    using T = std::decay_t<decltype(arg)>;
-    if constexpr (std::is_same_v<T, std::string>) {
-      std::cout << "A house called " << arg.c_str() << std::endl;
-    } else {
-      std::cout << "House number " << arg << std::endl;
-    }
-  });
+  std::visit(
+      [](auto& arg) {
+        using T = std::decay_t<decltype(arg)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+          std::cout << "A house called " << arg.c_str() << std::endl;
+        } else {
+          std::cout << "House number " << arg << std::endl;
+        }
+      },
+      house);
+}
+
+TEST(VisitorPatternTest, FlatExpressionMatchesClassicVisitor) {
+  FlatExpression flat;
+  auto root = flat.AddAddition(flat.AddDouble(1), flat.AddSubtraction(flat.AddDouble(2), flat.AddDouble(3.5)));
+
+  AdditionExpression classic{new DoubleExpression{1},
+                             new SubtractionExpression{new DoubleExpression{2}, new DoubleExpression{3.5}}};
+  ExpressionPrinter classic_printer;
+  ExpressionEvaluator classic_evaluator;
+  classic_printer.Visit(&classic);
+  classic_evaluator.Visit(&classic);
+
+  FlatExpressionPrinter printer;
+  printer.Print(flat);
+  FlatExpressionEvaluator evaluator;
+  ASSERT_EQ(classic_printer.str(), printer.str());
+  ASSERT_EQ("(1+2-3.5)", printer.str());  // ExpressionPrinter brackets a node whose right operand is a subtraction
+  ASSERT_DOUBLE_EQ(classic_evaluator.result_, evaluator.Evaluate(flat, root));
+
+  ASSERT_THROW(flat.AddAddition(root, root + 1), std::out_of_range);  // children come first
+  ASSERT_THROW(evaluator.Evaluate(flat, root + 1), std::out_of_range);
+  ASSERT_THROW(printer.Print(flat, root + 1), std::out_of_range);
+  ASSERT_EQ(classic_printer.str(), printer.str());
 }
-*/
+
+TEST(VisitorPatternTest, FlatExpressionHasNoRecursionDepthLimit) {
+  FlatExpression flat;
+  auto chain = flat.AddDouble(0);
+  for (int i = 0; i < 1000000; ++i) chain = flat.AddSubtraction(flat.AddDouble(1), chain);  // 1-(1-(1-...))
+
+  FlatExpressionEvaluator evaluator;
+  ASSERT_DOUBLE_EQ(0, evaluator.Evaluate(flat));
+  FlatExpressionPrinter printer;
+  printer.Print(flat);
+  ASSERT_EQ(0u, printer.str().find("(1-(1-(1-"));
+  ASSERT_EQ(1000000u * 4 - 1, printer.str().size());
+}
+
 }  // namespace